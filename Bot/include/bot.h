@@ -0,0 +1,108 @@
+#ifndef BOT_H_
+#define BOT_H_
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+#include "../../Common/include/Socket/socket_game.h"
+#include "../../Client/include/protocol.h"
+#include "../../libs/thread.h"
+#include "counting_socket.h"
+#include "load_stats.h"
+
+// Que hace el bot una vez en la partida.
+enum BotPattern : std::uint8_t {
+    PATTERN_WALK,  // camina de un lado al otro
+    PATTERN_SHOOT,  // dispara y recarga
+    PATTERN_MIXED  // camina, dispara y tira granadas
+};
+
+enum BotStep : std::uint8_t {
+    STEP_MOVE_RIGHT,
+    STEP_STOP_RIGHT,
+    STEP_MOVE_LEFT,
+    STEP_STOP_LEFT,
+    STEP_SHOOT,
+    STEP_STOP_SHOOT,
+    STEP_RELOAD,
+    STEP_STOP_RELOAD,
+    STEP_THROW,
+    STEP_STOP_THROW
+};
+
+/* El servidor no lo atendio por estar al limite */
+struct ServerFull : public std::runtime_error {
+    explicit ServerFull(const char *what) : std::runtime_error(what) {}
+};
+
+/* Cliente sin pantalla para generar carga. Crea o se une a una partida,
+elige soldado y despues el hilo principal le pide un paso del guion por vez
+con step() mientras el hilo del bot lee los snapshots y mide.
+Se descartan las ofertas de UDP: todo va por TCP. */
+
+class Bot : public Thread {
+    using Clock = std::chrono::steady_clock;
+
+    GameSocket socket;
+    CountingSocket counted;
+    Protocol protocol;
+    std::vector<BotStep> script;
+    std::size_t next_step;
+    std::uint16_t player_id;
+    std::atomic<bool> keep_receiving;
+    std::atomic<bool> is_running;
+    std::atomic<std::uint64_t> snapshots;
+
+    // eco pendiente, lo marca step() y lo cierra el hilo del bot
+    std::mutex echo_mtx;
+    bool echo_pending;
+    int echo_from_x;
+    Clock::time_point echo_sent;
+    int last_x;
+    bool seen_self;
+
+    LoadStats stats;
+    Clock::time_point last_snapshot;
+
+    /* Lee hasta el feedback de ese tipo. Tira ServerFull si llega un rechazo */
+    std::shared_ptr<Information> recvUntil(std::uint8_t type);
+    void onGameState(const GameStateFeedback& state);
+
+public:
+    /* Conecta con el servidor. phase desfasa el guion entre bots */
+    Bot(const char *hostname, const char *servname, BotPattern pattern, std::size_t phase);
+
+    /* Pide compresion deflate. Devuelve si el servidor la acepto */
+    bool requestCompression();
+
+    /* Crea una partida, el creador siempre es el jugador 1. Devuelve el codigo */
+    std::uint32_t createGame(std::uint8_t mode, std::uint8_t difficulty);
+
+    /* Se une como el jugador player_id (el orden de llegada a la partida).
+    Devuelve si el servidor lo acepto */
+    bool joinGame(std::uint32_t game_code, std::uint16_t player_id);
+
+    /* Elige un soldado segun el numero de bot */
+    void pickSoldier(std::size_t number);
+
+    /* Manda la siguiente accion del guion */
+    void step();
+
+    void run() override;
+    void stop();
+    [[nodiscard]] bool isDead() const;
+
+    [[nodiscard]] std::uint64_t snapshotsReceived() const;
+    [[nodiscard]] std::uint64_t bytesReceived() const;
+
+    /* Lo medido, leer despues de join() */
+    [[nodiscard]] LoadStats collect();
+
+    ~Bot() override = default;
+};
+
+#endif  // BOT_H_
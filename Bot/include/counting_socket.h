@@ -0,0 +1,31 @@
+#ifndef COUNTING_SOCKET_H_
+#define COUNTING_SOCKET_H_
+
+#include <atomic>
+#include <cstdint>
+#include "../../Common/include/Socket/socket_game.h"
+
+/* Envuelve un GameSocket y cuenta los bytes que pasan en cada sentido.
+Los contadores se pueden leer desde otro hilo mientras se usa. */
+
+class CountingSocket : public Socket {
+    GameSocket& socket;
+    std::atomic<std::uint64_t> bytes_sent;
+    std::atomic<std::uint64_t> bytes_received;
+
+public:
+    explicit CountingSocket(GameSocket& socket);
+
+    virtual void sendData(const void *data, std::size_t amount) override;
+    virtual void recvData(void *data, std::size_t amount) override;
+
+    [[nodiscard]] std::uint64_t sent() const;
+    [[nodiscard]] std::uint64_t received() const;
+
+    CountingSocket(const CountingSocket&) = delete;
+    CountingSocket& operator=(const CountingSocket&) = delete;
+
+    ~CountingSocket() override = default;
+};
+
+#endif  // COUNTING_SOCKET_H_
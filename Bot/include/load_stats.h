@@ -0,0 +1,44 @@
+#ifndef LOAD_STATS_H_
+#define LOAD_STATS_H_
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/* Muestras de tiempo en microsegundos. Cada bot junta las suyas sin
+sincronizar y al final se unen para el resumen. */
+
+class LatencySamples {
+    std::vector<std::uint32_t> samples;
+
+public:
+    LatencySamples() = default;
+
+    void add(std::uint32_t micros);
+
+    void merge(const LatencySamples& other);
+
+    [[nodiscard]] std::size_t count() const;
+
+    /* Una linea con cantidad, promedio, p50, p99 y maximo en milisegundos */
+    void print(std::ostream& out, const std::string& name) const;
+};
+
+/* Lo que mide un bot durante la prueba */
+struct LoadStats {
+    // tiempo entre snapshots consecutivos
+    LatencySamples snapshot_gap;
+    // desde que se manda un movimiento hasta que el snapshot lo refleja
+    LatencySamples command_echo;
+    std::uint64_t snapshots = 0;
+    std::uint64_t echo_lost = 0;
+    std::uint64_t bytes_received = 0;
+    std::uint64_t bytes_sent = 0;
+
+    void merge(const LoadStats& other);
+
+    void print(std::ostream& out, double seconds) const;
+};
+
+#endif  // LOAD_STATS_H_
@@ -0,0 +1,221 @@
+#include <iostream>
+
+#include "../include/bot.h"
+#include "../../Common/include/Information/information_code.h"
+#include "../../Common/include/Information/feedback_server_creategame.h"
+#include "../../Common/include/Information/feedback_server_joingame.h"
+#include "../../Common/include/Information/feedback_server_compression.h"
+#include "../../Common/include/Information/feedback_server_full.h"
+#include "../../Common/include/Information/Actions/game_create.h"
+#include "../../Common/include/Information/Actions/game_join.h"
+#include "../../Common/include/Information/Actions/moving_left_start.h"
+#include "../../Common/include/Information/Actions/moving_left_stop.h"
+#include "../../Common/include/Information/Actions/moving_right_start.h"
+#include "../../Common/include/Information/Actions/moving_right_stop.h"
+#include "../../Common/include/Information/Actions/reload_start.h"
+#include "../../Common/include/Information/Actions/reload_stop.h"
+#include "../../Common/include/Information/Actions/shoot_start.h"
+#include "../../Common/include/Information/Actions/shoot_stop.h"
+#include "../../Common/include/Information/Actions/throw_start.h"
+#include "../../Common/include/Information/Actions/throw_stop.h"
+#include "../../Common/include/Information/Requests/pick_soldier_idf.h"
+#include "../../Common/include/Information/Requests/pick_soldier_p90.h"
+#include "../../Common/include/Information/Requests/pick_soldier_scout.h"
+#include "../../Common/include/Information/Requests/compression.h"
+
+// si el movimiento no se ve en este tiempo se cuenta como perdido
+constexpr std::chrono::seconds ECHO_TIMEOUT(2);
+
+static std::vector<BotStep> buildScript(BotPattern pattern) {
+    switch (pattern) {
+    case PATTERN_WALK:
+        return {STEP_MOVE_RIGHT, STEP_STOP_RIGHT, STEP_MOVE_LEFT, STEP_STOP_LEFT};
+    case PATTERN_SHOOT:
+        return {STEP_SHOOT, STEP_STOP_SHOOT, STEP_RELOAD, STEP_STOP_RELOAD};
+    case PATTERN_MIXED:
+    default:
+        return {STEP_MOVE_RIGHT, STEP_STOP_RIGHT, STEP_SHOOT, STEP_STOP_SHOOT,
+                STEP_MOVE_LEFT, STEP_STOP_LEFT, STEP_THROW, STEP_STOP_THROW,
+                STEP_RELOAD, STEP_STOP_RELOAD};
+    }
+}
+
+static std::shared_ptr<Information> buildAction(BotStep step) {
+    using std::make_shared;
+    switch (step) {
+    case STEP_MOVE_RIGHT: return make_shared<StartMovingRightAction>();
+    case STEP_STOP_RIGHT: return make_shared<StopMovingRightAction>();
+    case STEP_MOVE_LEFT: return make_shared<StartMovingLeftAction>();
+    case STEP_STOP_LEFT: return make_shared<StopMovingLeftAction>();
+    case STEP_SHOOT: return make_shared<StartShootAction>();
+    case STEP_STOP_SHOOT: return make_shared<StopShootAction>();
+    case STEP_RELOAD: return make_shared<StartReloadAction>();
+    case STEP_STOP_RELOAD: return make_shared<StopReloadAction>();
+    case STEP_THROW: return make_shared<StartThrowAction>();
+    case STEP_STOP_THROW:
+    default: return make_shared<StopThrowAction>();
+    }
+}
+
+//------------------------PRIVATE METHODS-----------------------------------//
+
+std::shared_ptr<Information> Bot::recvUntil(std::uint8_t type) {
+    while (true) {
+        std::shared_ptr<Information> feed = protocol.recvFeedback();
+        if (feed == nullptr) {
+            throw std::runtime_error("Bot::recvUntil. Invalid feedback.\n");
+        }
+        if (feed->get_type() == type) return feed;
+        if (feed->get_type() == FEEDBACK_SERVER_FULL) {
+            throw ServerFull(static_cast<ServerFullFeedback&>(*feed).reason == FULL_GAMES ?
+                             "no more games allowed" : "no more connections allowed");
+        }
+    }
+}
+
+void Bot::onGameState(const GameStateFeedback &state) {
+    Clock::time_point now = Clock::now();
+    if (stats.snapshots > 0) {
+        stats.snapshot_gap.add(std::chrono::duration_cast<std::chrono::microseconds>(
+                now - last_snapshot).count());
+    }
+    last_snapshot = now;
+    stats.snapshots++;
+    snapshots++;
+
+    for (const auto& element : state.elements) {
+        if (element.first != player_id) continue;
+        std::unique_lock<std::mutex> lck(echo_mtx);
+        last_x = element.second.position_x;
+        seen_self = true;
+        if (echo_pending && last_x != echo_from_x) {
+            echo_pending = false;
+            stats.command_echo.add(std::chrono::duration_cast<std::chrono::microseconds>(
+                    now - echo_sent).count());
+        }
+        break;
+    }
+}
+
+//------------------------PUBLIC METHODS------------------------------------//
+
+Bot::Bot(const char *hostname, const char *servname, BotPattern pattern, std::size_t phase) :
+    socket(hostname, servname),
+    counted(socket),
+    protocol(counted),
+    script(buildScript(pattern)),
+    next_step(phase % script.size()),
+    player_id(0),
+    keep_receiving(true),
+    is_running(true),
+    snapshots(0),
+    echo_mtx(),
+    echo_pending(false),
+    echo_from_x(0),
+    echo_sent(),
+    last_x(0),
+    seen_self(false),
+    stats(),
+    last_snapshot() {
+    SocketOptions options;
+    options.no_delay = true;
+    socket.applyOptions(options);
+}
+
+bool Bot::requestCompression() {
+    protocol.sendAction(CompressionRequest(COMPRESSION_DEFLATE));
+    std::shared_ptr<Information> feed = recvUntil(FEEDBACK_COMPRESSION);
+    return static_cast<CompressionFeedback&>(*feed).codec == COMPRESSION_DEFLATE;
+}
+
+std::uint32_t Bot::createGame(std::uint8_t mode, std::uint8_t difficulty) {
+    protocol.sendAction(CreateGameAction(mode, difficulty));
+    std::shared_ptr<Information> feed = recvUntil(FEEDBACK_CREATE_GAME);
+    player_id = 1;
+    return static_cast<CreateGameFeedback&>(*feed).game_code;
+}
+
+bool Bot::joinGame(std::uint32_t game_code, std::uint16_t player_id) {
+    protocol.sendAction(JoinGameAction(game_code));
+    std::shared_ptr<Information> feed = recvUntil(FEEDBACK_JOIN_GAME);
+    this->player_id = player_id;
+    return static_cast<JoinGameFeedback&>(*feed).joined == JOINED;
+}
+
+void Bot::pickSoldier(std::size_t number) {
+    switch (number % 3) {
+    case 0: protocol.sendAction(PickIdfSoldierRequest()); break;
+    case 1: protocol.sendAction(PickP90SoldierRequest()); break;
+    default: protocol.sendAction(PickScoutSoldierRequest()); break;
+    }
+}
+
+void Bot::step() {
+    BotStep current = script[next_step];
+    next_step = (next_step + 1) % script.size();
+
+    if (current == STEP_MOVE_RIGHT || current == STEP_MOVE_LEFT) {
+        std::unique_lock<std::mutex> lck(echo_mtx);
+        Clock::time_point now = Clock::now();
+        if (echo_pending && now - echo_sent > ECHO_TIMEOUT) {
+            echo_pending = false;
+            stats.echo_lost++;
+        }
+        // se mide solo si el soldado ya aparecio y esta quieto
+        if (seen_self && !echo_pending) {
+            echo_pending = true;
+            echo_from_x = last_x;
+            echo_sent = now;
+        }
+    }
+    protocol.sendAction(*buildAction(current));
+}
+
+void Bot::run() {
+    using std::cerr;
+    using std::endl;
+
+    try {
+    while (keep_receiving) {
+        std::shared_ptr<Information> feed = protocol.recvFeedback();
+        if (feed == nullptr) {
+            throw std::runtime_error("Bot::run. Invalid feedback.\n");
+        }
+        std::uint8_t type = feed->get_type();
+        if (type == FEEDBACK_GAME_STATE || type == FEEDBACK_GAME_STATE_COMPACT) {
+            onGameState(static_cast<const GameStateFeedback&>(*feed));
+        }
+    }
+    } catch (const ClosedSocket& err) {
+        keep_receiving = false;
+    } catch (const std::exception& e) {
+        if (keep_receiving) {
+            cerr << "Bot " << static_cast<int>(player_id) << ": " << e.what() << endl;
+        }
+        keep_receiving = false;
+    }
+    is_running = false;
+}
+
+void Bot::stop() {
+    keep_receiving = false;
+    socket._shutdown(SHUT_RDWR);
+}
+
+bool Bot::isDead() const {
+    return !is_running;
+}
+
+std::uint64_t Bot::snapshotsReceived() const {
+    return snapshots;
+}
+
+std::uint64_t Bot::bytesReceived() const {
+    return counted.received();
+}
+
+LoadStats Bot::collect() {
+    stats.bytes_received = counted.received();
+    stats.bytes_sent = counted.sent();
+    return stats;
+}
@@ -0,0 +1,25 @@
+#include "../include/counting_socket.h"
+
+CountingSocket::CountingSocket(GameSocket &socket) :
+    socket(socket),
+    bytes_sent(0),
+    bytes_received(0) {
+}
+
+void CountingSocket::sendData(const void *data, std::size_t amount) {
+    socket.sendData(data, amount);
+    bytes_sent += amount;
+}
+
+void CountingSocket::recvData(void *data, std::size_t amount) {
+    socket.recvData(data, amount);
+    bytes_received += amount;
+}
+
+std::uint64_t CountingSocket::sent() const {
+    return bytes_sent;
+}
+
+std::uint64_t CountingSocket::received() const {
+    return bytes_received;
+}
@@ -0,0 +1,57 @@
+#include <algorithm>
+#include <iomanip>
+#include <numeric>
+
+#include "../include/load_stats.h"
+
+void LatencySamples::add(std::uint32_t micros) {
+    samples.push_back(micros);
+}
+
+void LatencySamples::merge(const LatencySamples &other) {
+    samples.insert(samples.end(), other.samples.begin(), other.samples.end());
+}
+
+std::size_t LatencySamples::count() const {
+    return samples.size();
+}
+
+void LatencySamples::print(std::ostream &out, const std::string &name) const {
+    out << std::left << std::setw(16) << name << std::right;
+    if (samples.empty()) {
+        out << "sin muestras" << std::endl;
+        return;
+    }
+    std::vector<std::uint32_t> sorted(samples);
+    std::sort(sorted.begin(), sorted.end());
+    auto at = [&sorted](double quantile) {
+        return sorted[static_cast<std::size_t>(quantile * (sorted.size() - 1))] / 1000.0;
+    };
+    double mean = std::accumulate(sorted.begin(), sorted.end(), 0.0) / sorted.size() / 1000.0;
+    out << std::fixed << std::setprecision(2)
+        << "n=" << sorted.size()
+        << " media=" << mean << "ms"
+        << " p50=" << at(0.5) << "ms"
+        << " p99=" << at(0.99) << "ms"
+        << " max=" << sorted.back() / 1000.0 << "ms" << std::endl;
+}
+
+void LoadStats::merge(const LoadStats &other) {
+    snapshot_gap.merge(other.snapshot_gap);
+    command_echo.merge(other.command_echo);
+    snapshots += other.snapshots;
+    echo_lost += other.echo_lost;
+    bytes_received += other.bytes_received;
+    bytes_sent += other.bytes_sent;
+}
+
+void LoadStats::print(std::ostream &out, double seconds) const {
+    snapshot_gap.print(out, "entre snapshots");
+    command_echo.print(out, "eco de comando");
+    out << std::fixed << std::setprecision(1)
+        << "snapshots: " << snapshots << " (" << snapshots / seconds << "/s)\n"
+        << "ecos perdidos: " << echo_lost << "\n"
+        << "recibido: " << bytes_received / 1024.0 << " KiB ("
+        << bytes_received / 1024.0 / seconds << " KiB/s)\n"
+        << "enviado: " << bytes_sent / 1024.0 << " KiB" << std::endl;
+}
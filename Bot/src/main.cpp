@@ -0,0 +1,131 @@
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../include/bot.h"
+#include "../../Common/include/Information/information_code.h"
+
+// el servidor acepta hasta 10 jugadores por partida
+constexpr std::size_t MAX_PLAYERS_PER_GAME = 10;
+// cada cuanto cada bot da un paso del guion
+constexpr std::chrono::milliseconds STEP_PERIOD(250);
+
+static BotPattern parsePattern(const std::string& name) {
+    if (name == "walk") return PATTERN_WALK;
+    if (name == "shoot") return PATTERN_SHOOT;
+    if (name == "mixed") return PATTERN_MIXED;
+    throw std::runtime_error("Unknown pattern: " + name + ". Expected walk, shoot or mixed.\n");
+}
+
+int main(int argc, char* argv[]) {
+    using std::cerr;
+    using std::cout;
+    using std::endl;
+    using std::chrono::steady_clock;
+
+    if (argc < 4 || argc > 8) {
+        cerr << "Usage: ./Bot <ip> <port> <bots> [bots_per_game=4] [seconds=30] [walk|shoot|mixed] [raw|deflate]"
+        "\nExample: ./Bot localhost 8080 200 4 60 mixed deflate" << endl;
+        return EXIT_FAILURE;
+    }
+    // los que ya arrancaron se frenan aunque falle el armado de los demas
+    std::vector<std::unique_ptr<Bot>> bots;
+    auto stopAll = [&bots]() {
+        for (auto& bot : bots) bot->stop();
+        for (auto& bot : bots) bot->join();
+    };
+    try {
+        const char* hostname = argv[1];
+        const char* servname = argv[2];
+        std::size_t bots_amount = std::stoul(argv[3]);
+        std::size_t per_game = (argc > 4) ? std::stoul(argv[4]) : 4;
+        int seconds = (argc > 5) ? std::stoi(argv[5]) : 30;
+        BotPattern pattern = parsePattern((argc > 6) ? argv[6] : "mixed");
+        bool compress = (argc > 7) && std::string(argv[7]) == "deflate";
+        if (per_game == 0 || per_game > MAX_PLAYERS_PER_GAME) {
+            throw std::runtime_error("bots_per_game must be between 1 and 10.\n");
+        }
+
+        // Las partidas se arman de a un bot por vez: asi cada uno sabe que
+        // id de jugador le toca y puede reconocer su soldado en los snapshots.
+        bots.reserve(bots_amount);
+        // los que el servidor rechaza por estar lleno se cuentan y se sigue
+        std::size_t rejected = 0;
+        std::uint32_t game_code = 0;
+        for (std::size_t number = 0; number < bots_amount; number++) {
+            std::size_t seat = number % per_game;
+            if (seat != 0 && game_code == 0) {
+                rejected++;
+                continue;
+            }
+            try {
+                std::unique_ptr<Bot> bot(new Bot(hostname, servname, pattern, number));
+                if (compress && !bot->requestCompression()) {
+                    throw std::runtime_error("The server rejected compression.\n");
+                }
+                if (seat == 0) {
+                    game_code = 0;
+                    game_code = bot->createGame(REQUEST_SURVIVAL, REQUEST_NORMAL);
+                } else if (!bot->joinGame(game_code, seat + 1)) {
+                    throw std::runtime_error("Bot could not join game " + std::to_string(game_code) + ".\n");
+                }
+                bot->pickSoldier(number);
+                bot->start();
+                bots.push_back(std::move(bot));
+            } catch (const ServerFull& e) {
+                rejected++;
+            }
+        }
+        cout << bots.size() << " bots en " << (bots.size() + per_game - 1) / per_game
+             << " partidas, " << rejected << " rechazados por el servidor" << endl;
+
+        steady_clock::time_point begin = steady_clock::now();
+        steady_clock::time_point end = begin + std::chrono::seconds(seconds);
+        steady_clock::time_point next_step = begin;
+        steady_clock::time_point next_report = begin + std::chrono::seconds(1);
+        std::uint64_t last_snapshots = 0;
+        std::uint64_t last_bytes = 0;
+        while (steady_clock::now() < end) {
+            std::this_thread::sleep_until(next_step);
+            next_step += STEP_PERIOD;
+            std::size_t alive = 0;
+            for (auto& bot : bots) {
+                if (bot->isDead()) continue;
+                alive++;
+                try {
+                    bot->step();
+                } catch (const std::exception& e) {
+                    // el servidor lo echo, el resto sigue
+                    bot->stop();
+                }
+            }
+            if (steady_clock::now() < next_report) continue;
+            next_report += std::chrono::seconds(1);
+            std::uint64_t total_snapshots = 0;
+            std::uint64_t total_bytes = 0;
+            for (auto& bot : bots) {
+                total_snapshots += bot->snapshotsReceived();
+                total_bytes += bot->bytesReceived();
+            }
+            cout << "vivos " << alive << "  snapshots/s " << total_snapshots - last_snapshots
+                 << "  KiB/s " << (total_bytes - last_bytes) / 1024 << endl;
+            last_snapshots = total_snapshots;
+            last_bytes = total_bytes;
+        }
+
+        stopAll();
+        LoadStats total;
+        for (auto& bot : bots) total.merge(bot->collect());
+        double elapsed = std::chrono::duration<double>(steady_clock::now() - begin).count();
+        total.print(cout, elapsed);
+    } catch (const std::exception& e) {
+        cerr << "An exception was caught in the main thread: " << e.what() << endl;
+        stopAll();
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
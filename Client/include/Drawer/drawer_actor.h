@@ -7,13 +7,11 @@
 
 #include "../Animations/animation_manager.h"
 #include "../../../Common/include/Information/state_dto_element.h"
-#include "drawer_hpbar.h"
 
 // La ventaja de tener SoldierOneDrawer con un action específico Drawer es
 // cada action drawer puede guardar un estado distinto!
 class ActorDrawer {
     AnimationManager& animation_manager;
-    HealthBarDrawer hp_drawer;
 
     std::uint8_t type;
     std::uint8_t animation;
@@ -28,14 +26,14 @@ class ActorDrawer {
     unsigned int previous_frame_ticks;
 public:
 
-    explicit ActorDrawer(AnimationManager &animation_manager, SDL2pp::Renderer &renderer);
+    explicit ActorDrawer(AnimationManager &animation_manager);
     // Necesito saber la cantidad de sprites para mandar un indice válido!
     // Primero hacer los calculos en update y guardar esa info.
     // Segundo hacer otro metodo draw que reciba una ref a HPBarDrawer
     void updateInfo(const ElementStateDTO &actor_state, std::int32_t window_x_pos, std::int32_t window_width,
                     std::int32_t window_height);
     void draw(std::uint32_t frame_ticks);
-    void drawBar();
+    [[nodiscard]] const SDL2pp::Point& getSpriteDestination() const;
 private:
     // void setActorType(uint8_t actor_type);
     // void setActorAnimation(uint8_t actor_action);
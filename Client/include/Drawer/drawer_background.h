@@ -5,16 +5,26 @@
 #ifndef TP_DRAWER_BACKGROUND_H
 #define TP_DRAWER_BACKGROUND_H
 
+#include <SDL2pp/Texture.hh>
 #include "../Background/background_manager.h"
 #include "drawer_layer.h"
 
 // Puedo tener varios background drawers en drawer manager.
 class BackgroundDrawer {
+    SDL2pp::Renderer& renderer;
     BackgroundManager background_manager;
     std::uint8_t background_type;
     std::array<LayerDrawer, WAR_1_BEHIND_COUNT> layers_to_draw_behind; // care with the order.
     std::array<LayerDrawer, WAR_1_FRONT_COUNT> layers_to_draw_ahead;
 
+    // Las capas de atras que casi no se mueven (cielo, sol, ruinas...) se
+    // componen en una textura y se copian de una sola vez cada frame.
+    SDL2pp::Texture composite;
+    std::size_t cached_layers_count;
+    std::int32_t composite_window_x_pos;
+    bool composite_dirty;
+
+    void recomposite();
 public:
     explicit BackgroundDrawer(SDL2pp::Renderer& renderer,
                      std::uint8_t background_type,
@@ -0,0 +1,22 @@
+#ifndef TP_DRAWER_FRAME_OVERLAY_H
+#define TP_DRAWER_FRAME_OVERLAY_H
+
+#include <array>
+#include <SDL2pp/Renderer.hh>
+#include "../frame_pacer.h"
+
+// Barra apilada arriba a la izquierda: un color por fase del frame y una
+// linea blanca en el tiempo objetivo. Sin texto para no depender de fuentes.
+class FrameOverlayDrawer {
+    SDL2pp::Renderer& renderer;
+    std::array<SDL2pp::Color, PHASE_LAST> phase_colors;
+    SDL2pp::Color background_color;
+    SDL2pp::Color budget_color;
+
+public:
+    explicit FrameOverlayDrawer(SDL2pp::Renderer& renderer);
+
+    void draw(const FramePacer& frame_pacer);
+};
+
+#endif //TP_DRAWER_FRAME_OVERLAY_H
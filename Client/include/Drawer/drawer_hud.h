@@ -0,0 +1,57 @@
+#ifndef TP_DRAWER_HUD_H
+#define TP_DRAWER_HUD_H
+
+#include <map>
+#include <vector>
+#include <SDL2pp/Renderer.hh>
+#include "../../../Common/include/Information/state_dto_element.h"
+
+// Lo que se muestra de cada soldado, con vida y balas en pasos de 1%.
+// anchor es donde esta el sprite en pantalla: cambia con la camara y no
+// obliga a rearmar las barras.
+struct HudEntry {
+    std::uint8_t health_step;
+    std::uint8_t ammo_step;
+    SDL2pp::Point anchor;
+    bool visible;
+};
+
+/*
+ * Barras de vida y balas de todos los soldados. Los rectangulos se arman
+ * solo cuando cambia algun valor (cuantizado) o quien se ve; en cada draw
+ * solo se los mueve a la posicion del sprite. Se dibujan con un FillRects
+ * por color: la cantidad de llamadas no depende de los jugadores.
+ */
+class HudDrawer {
+    SDL2pp::Renderer& renderer;
+    SDL2pp::Color background_color;
+    SDL2pp::Color health_color;
+    SDL2pp::Color ammo_color;
+
+    std::map<std::uint16_t, HudEntry> entries;
+    std::vector<SDL2pp::Rect> background_quads;
+    std::vector<SDL2pp::Rect> health_quads;
+    std::vector<SDL2pp::Rect> ammo_quads;
+    // de quien es cada trio de rectangulos, en el mismo orden
+    std::vector<const HudEntry*> quad_entries;
+    bool quads_dirty;
+
+    void rebuildQuads();
+    void placeQuads();
+    void fillQuads(const SDL2pp::Color& color, const std::vector<SDL2pp::Rect>& quads);
+
+public:
+    explicit HudDrawer(SDL2pp::Renderer& renderer);
+
+    void updateActor(std::uint16_t actor_id, const ElementStateDTO& actor_state,
+                     const SDL2pp::Point& sprite_destination);
+
+    // El actor sigue en juego pero fuera de la ventana.
+    void hideActor(std::uint16_t actor_id);
+
+    void removeActor(std::uint16_t actor_id);
+
+    void draw();
+};
+
+#endif //TP_DRAWER_HUD_H
@@ -35,6 +35,8 @@ public:
 
     void updateInfo(std::int32_t window_x_pos, std::int32_t window_width, std::int32_t window_height);
 
+    [[nodiscard]] double getSpeed() const;
+
     LayerDrawer(LayerDrawer&&) = default;
     LayerDrawer& operator=(LayerDrawer&&) = delete;
 
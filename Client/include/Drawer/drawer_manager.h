@@ -6,25 +6,47 @@
 #define TP_DRAWER_MANAGER_H
 
 #include <map>
+#include <set>
 #include "drawer_actor.h"
+#include "drawer_hud.h"
 #include "../../../Common/include/Information/score_dto.h"
 
 class DrawerManager {
     AnimationManager animation_manager;
-    SDL2pp::Renderer& renderer;
     std::map<std::uint16_t, ActorDrawer> actor_drawers;
+    HudDrawer hud_drawer;
+    // El mapa mide 50000 y la ventana ve una porcion chica: se agrupan los
+    // actores por franjas en x y solo se recorren las que toca la ventana.
+    std::map<std::int32_t, std::set<std::uint16_t>> x_buckets;
+    std::map<std::uint16_t, std::int32_t> actor_buckets;
+    std::int32_t first_visible_bucket;
+    std::int32_t last_visible_bucket;
+    // Ids que vinieron en el snapshot que se esta procesando.
+    std::set<std::uint16_t> updated_actors;
 
     std::_Rb_tree_iterator<std::pair<const uint16_t, ActorDrawer>>
-    addActor(std::uint16_t actor_id, const ElementStateDTO &actor_state, std::int32_t window_x_pos,
-             std::int32_t window_width, std::int32_t window_height);
+    addActor(std::uint16_t actor_id, std::int32_t bucket);
+
+    void moveActor(std::uint16_t actor_id, std::int32_t &actor_bucket, std::int32_t bucket);
+
+    [[nodiscard]] bool isVisible(std::int32_t bucket) const;
 public:
     explicit DrawerManager(SDL2pp::Renderer& renderer);
 
     void draw(std::uint32_t frame_ticks);
 
+    // Se llama antes de procesar un snapshot con la ventana actual.
+    void beginUpdate(std::int32_t window_x_pos, std::int32_t window_width);
+
     void updateInfo(std::uint16_t actor_id, const ElementStateDTO &actor_state, std::int32_t window_x_pos,
                     std::int32_t window_width, std::int32_t window_height);
 
+    // Cierra el snapshot: cada uno trae todo el area de interes, asi que se
+    // borran los actores que no vinieron aunque se haya perdido su salida.
+    void endUpdate();
+
+    // Actores que el server saco del area de interes (o murieron).
+    void removeActor(std::uint16_t actor_id);
 };
 
 #endif //TP_DRAWER_MANAGER_H
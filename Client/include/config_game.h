@@ -13,6 +13,12 @@ class GameConfig {
 public:
     const std::uint16_t window_width;
     const std::uint16_t window_height;
+    const std::uint16_t target_fps;
+    const bool vsync;
+    const bool frame_overlay;
+    const bool use_datagrams;
+    const bool tcp_nodelay;
+    const bool compression;
 
     GameConfig();
 };
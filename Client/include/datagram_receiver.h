@@ -0,0 +1,38 @@
+#ifndef TP_DATAGRAM_RECEIVER_H
+#define TP_DATAGRAM_RECEIVER_H
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+#include "../../Common/include/Information/information.h"
+#include "../../Common/include/Socket/socket_datagram.h"
+#include "../../libs/queue.h"
+#include "../../libs/thread.h"
+
+/* Recibe los snapshots que el servidor manda por UDP y los encola junto
+con lo que llega por TCP. Los que llegan fuera de orden o repetidos se
+descartan: solo importa el estado mas nuevo. */
+
+class DatagramReceiver : public Thread {
+    Queue<std::shared_ptr<Information>>& feedback_received;
+    DatagramSocket socket;
+    std::uint32_t token;
+    std::uint32_t last_sequence;
+    bool has_sequence;
+    std::vector<std::int8_t> buffer;
+    std::atomic<bool> is_running;
+    std::atomic<bool> keep_receiving;
+
+    void sendHello();
+
+public:
+    DatagramReceiver(Queue<std::shared_ptr<Information>>& feedback_received,
+                     const std::string& hostname, std::uint16_t port, std::uint32_t token);
+    void stop();
+    void run() override;
+    [[nodiscard]] bool isDead() const;
+    ~DatagramReceiver() override = default;
+};
+
+#endif //TP_DATAGRAM_RECEIVER_H
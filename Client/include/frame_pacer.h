@@ -0,0 +1,50 @@
+#ifndef TP_FRAME_PACER_H
+#define TP_FRAME_PACER_H
+
+#include <array>
+#include <cstdint>
+
+// Partes del frame que se miden, en el orden en que pasan en ClientGame.
+enum FramePhase : std::uint8_t {
+    PHASE_EVENTS,
+    PHASE_SNAPSHOT,
+    PHASE_BACKGROUND,
+    PHASE_ACTORS,
+    PHASE_PRESENT,
+    PHASE_LAST
+};
+
+/*
+ * Marca el ritmo del loop con SDL_GetPerformanceCounter (resolucion de
+ * microsegundos, no los ms enteros de SDL_GetTicks) y mide cuanto tarda cada
+ * parte del frame. Con vsync el Present ya bloquea, asi que no duerme.
+ */
+class FramePacer {
+    const std::uint64_t counter_frequency;
+    const std::uint64_t counter_per_frame;
+    const bool vsync;
+
+    std::uint64_t frame_deadline;
+    std::uint64_t frame_start;
+    std::uint64_t lap_start;
+    // Promedios suavizados en ms, para que el overlay no tiemble.
+    std::array<float, PHASE_LAST> phase_ms;
+    float frame_ms;
+
+public:
+    FramePacer(std::uint16_t target_fps, bool vsync);
+
+    void beginFrame();
+
+    // Cierra la fase actual y arranca a medir la siguiente.
+    void lap(FramePhase phase);
+
+    // Duerme lo que falta del frame, sin pasarse del deadline.
+    void waitNextFrame();
+
+    [[nodiscard]] float getPhaseMs(FramePhase phase) const;
+    [[nodiscard]] float getFrameMs() const;
+    [[nodiscard]] float getTargetFrameMs() const;
+};
+
+#endif //TP_FRAME_PACER_H
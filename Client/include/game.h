@@ -11,15 +11,23 @@
 #include "handler_event.h"
 #include "lobby.h"
 #include "music_game.h"
+#include "frame_pacer.h"
 
 class ClientGame {
     GameConfig config;
     GameVisual game_visual;
     GameMusic game_music;
+    Queue<std::shared_ptr<Information>>& actions_to_send;
     Queue<std::shared_ptr<Information>>& feedback_received;
 
     bool quit;
+    bool show_frame_overlay;
     EventHandler event_handler;
+    FramePacer frame_pacer;
+    std::int32_t last_view_hint_x;
+
+    // Le avisa al server que parte del mapa se ve, solo si la camara se movio.
+    void sendViewHint();
 
 public:
     ClientGame(
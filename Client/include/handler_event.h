@@ -18,6 +18,7 @@ class EventHandler {
     GameMusic& game_music;
 
     bool* quit;
+    bool* show_frame_overlay;
     SDL_Event event;
     /*
      * Un map tiene menos performance en run time y usa mas memoria para ints.
@@ -35,7 +36,7 @@ class EventHandler {
     // void processKeyUp() const;
 public:
     EventHandler(Queue<std::shared_ptr<Information>>& actions_to_send,
-                 bool* quit, GameMusic& game_music);
+                 bool* quit, bool* show_frame_overlay, GameMusic& game_music);
 
     void start();
 };
@@ -2,14 +2,20 @@
 #define PROTOCOL_H_
 
 #include <memory>
+#include <vector>
 #include "../../Common/include/Socket/socket_game.h"
+#include "../../Common/include/Socket/frame_compression.h"
 #include "../../Common/include/Information/information.h"
 #include "../../Common/include/Information/feedback_server_creategame.h"
 #include "../../Common/include/Information/feedback_server_gamestate.h"
 #include "../../Common/include/Information/feedback_server_score.h"
 
 class Protocol {
-    GameSocket& socket;
+    Socket& socket;
+    // Se crea con el primer FEEDBACK_COMPRESSED y sigue el stream del servidor.
+    std::unique_ptr<FrameInflater> inflater;
+    std::vector<std::int8_t> compressed;
+    std::vector<std::int8_t> inflated;
 
     ElementStateDTO recvActorState();
     ScoreDTO recvScore();
@@ -17,9 +23,16 @@ class Protocol {
     [[nodiscard]] std::shared_ptr<Information> builtJoinGameFeedback();
     [[nodiscard]] std::shared_ptr<Information> builtGameStateFeedback();
     [[nodiscard]] std::shared_ptr<Information> builtGameScoreFeedback();
+    [[nodiscard]] std::shared_ptr<Information> builtCompactGameStateFeedback();
+    [[nodiscard]] std::shared_ptr<Information> builtDatagramOfferFeedback();
+    [[nodiscard]] std::shared_ptr<Information> builtCompressionFeedback();
+    [[nodiscard]] std::shared_ptr<Information> builtCompressedFeedback();
+    [[nodiscard]] std::shared_ptr<Information> builtServerFullFeedback();
+    [[nodiscard]] std::shared_ptr<Information> builtGameListFeedback();
 
 public:
-    explicit Protocol(GameSocket& socket);
+    // Socket puede ser el TCP o un BufferSocket con el contenido de un datagrama.
+    explicit Protocol(Socket& socket);
 
     void sendAction(const Information& action);
 
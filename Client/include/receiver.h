@@ -7,25 +7,36 @@
 
 #include <atomic>
 #include <memory>
+#include <mutex>
+#include <string>
 #include "../../Common/include/Information/information.h"
 #include "../../libs/queue.h"
 #include "../../libs/thread.h"
 #include "protocol.h"
+#include "datagram_receiver.h"
 
 class Receiver : public Thread {
     Queue<std::shared_ptr<Information>>& feedback_received;
     Protocol protocol;
     GameSocket& socket;
+    std::string hostname;
+    bool use_datagrams;
+    // Snapshots por UDP, se arranca si el servidor lo ofrece y esta habilitado.
+    std::unique_ptr<DatagramReceiver> datagram_receiver;
+    // stop() llega desde otro hilo mientras run() puede estar creandolo.
+    std::mutex datagram_mutex;
     std::atomic<bool> is_running;
     std::atomic<bool> keep_receiving;
 
+    void acceptDatagramOffer(const Information& offer);
+
 public:
     Receiver(Queue<std::shared_ptr<Information>>& feedback_received,
-             GameSocket& socket);
+             GameSocket& socket, const std::string& hostname);
     void stop();
     void run() override;
     [[nodiscard]] bool isDead() const;
-    ~Receiver() override = default;
+    ~Receiver() override;
 };
 
 #endif //TP_RECEIVER_H
@@ -13,6 +13,7 @@
 #include "../../Common/include/Information/feedback_server_score.h"
 #include "Drawer/drawer_manager.h"
 #include "Drawer/drawer_background.h"
+#include "Drawer/drawer_frame_overlay.h"
 
 class GameVisual {
     SDL2pp::SDL sdl;
@@ -20,13 +21,22 @@ class GameVisual {
     SDL2pp::Renderer renderer;
     DrawerManager drawer_manager;  // (id, drawer)
     BackgroundDrawer background_drawer;
+    FrameOverlayDrawer frame_overlay_drawer;
     std::int32_t window_x_position;
 
 public:
-    GameVisual(std::uint16_t window_width, std::uint16_t window_height);
+    GameVisual(std::uint16_t window_width, std::uint16_t window_height, bool vsync);
 
-    void draw(unsigned int frameticks);
+    // se dibuja por partes, para medir cada una.
+    void drawBackground();
+    void drawActors(unsigned int frameticks);
+    void drawFrameOverlay(const FramePacer& frame_pacer);
     void updateInfo(const GameStateFeedback& feed);
+    // Solo aplica las salidas del area de interes, para snapshots que se saltean.
+    void removeLeftActors(const GameStateFeedback& feed);
+
+    [[nodiscard]] std::int32_t getWindowX() const;
+    [[nodiscard]] std::uint16_t getWindowWidth() const;
 
     void clear();
     void present();
@@ -9,9 +9,8 @@ constexpr std::int16_t TOLERANCE = 200;
 constexpr float ROAD_RATIO = 0.150;
 constexpr float SV_MAP_HEIGHT = 200;
 
-ActorDrawer::ActorDrawer(AnimationManager &animation_manager, SDL2pp::Renderer &renderer) :
+ActorDrawer::ActorDrawer(AnimationManager &animation_manager) :
         animation_manager(animation_manager),
-        hp_drawer(renderer),
         type(SOLDIER_IDF),
         animation(SOLDIER_1_IDLE),
         direction(DRAW_RIGHT),
@@ -58,8 +57,6 @@ ActorDrawer::updateInfo(const ElementStateDTO &actor_state, std::int32_t window_
     } else {
         drawable = true;
     }
-    hp_drawer.updateInfo(static_cast<float>(actor_state.actual_health) / static_cast<float>(actor_state.health), sprite_destination);
-
 }
 
 void ActorDrawer::draw(std::uint32_t frame_ticks) {
@@ -91,6 +88,6 @@ void ActorDrawer::setActorDirection(int8_t actor_direction) {
     }
 }
 
-void ActorDrawer::drawBar() {
-    hp_drawer.draw();
+const SDL2pp::Point& ActorDrawer::getSpriteDestination() const {
+    return sprite_destination;
 }
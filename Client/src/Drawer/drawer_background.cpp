@@ -1,10 +1,24 @@
 //
 // Created by luan on 22/06/23.
 //
+#include <cstdlib>
 #include "../../include/Drawer/drawer_background.h"
+
+// Las capas con velocidad hasta este valor van a la textura compuesta.
+constexpr double CACHE_MAX_SPEED = 0.4;
+// Cuantos pixeles se puede atrasar una capa cacheada antes de recomponer.
+constexpr double RECOMPOSITE_THRESHOLD = 4;
+
+static SDL2pp::Texture createComposite(SDL2pp::Renderer& renderer, std::int32_t width, std::int32_t height) {
+    SDL2pp::Texture texture(renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, width, height);
+    texture.SetBlendMode(SDL_BLENDMODE_BLEND);
+    return texture;
+}
+
 // Puedo dividir los layers en repetible y no repetible (cielo, sol y calle deben repetirse, el resto no por ser deco)
 BackgroundDrawer::BackgroundDrawer(SDL2pp::Renderer& renderer, std::uint8_t background_type,
                                    std::int32_t window_width, std::int32_t window_height) :
+    renderer(renderer),
     background_manager(renderer),
     background_type(background_type),
     layers_to_draw_behind{
@@ -18,14 +32,26 @@ BackgroundDrawer::BackgroundDrawer(SDL2pp::Renderer& renderer, std::uint8_t back
     },
     layers_to_draw_ahead{
             LayerDrawer(background_manager, WAR_1_LAYER_FENCE, 0, window_width, window_width)
-    } {
-
+    },
+    composite(createComposite(renderer, window_width, window_height)),
+    cached_layers_count(0),
+    composite_window_x_pos(0),
+    composite_dirty(true) {
+    // Solo las capas lentas del fondo: las de adelante se dibujan encima.
+    while (cached_layers_count < layers_to_draw_behind.size() &&
+           layers_to_draw_behind.at(cached_layers_count).getSpeed() <= CACHE_MAX_SPEED) {
+        cached_layers_count++;
+    }
 }
 
 void BackgroundDrawer::drawBehindLayers() {
+    if (composite_dirty) {
+        recomposite();
+    }
+    renderer.Copy(composite);
 
-    for (auto& layer : layers_to_draw_behind) {
-        layer.draw(background_type);
+    for (std::size_t index = cached_layers_count; index < layers_to_draw_behind.size(); index++) {
+        layers_to_draw_behind.at(index).draw(background_type);
     }
 }
 
@@ -33,5 +59,28 @@ void BackgroundDrawer::updateInfo(std::int32_t window_x_pos, std::int32_t window
     for (auto& layer : layers_to_draw_behind) {
         layer.updateInfo(window_x_pos, window_width, window_height);
     }
+
+    if (composite.GetWidth() != window_width || composite.GetHeight() != window_height) {
+        composite = createComposite(renderer, window_width, window_height);
+        composite_dirty = true;
+    }
+    double max_shift = std::abs(window_x_pos - composite_window_x_pos) * CACHE_MAX_SPEED;
+    if (max_shift >= RECOMPOSITE_THRESHOLD) {
+        composite_dirty = true;
+    }
+    if (composite_dirty) {
+        composite_window_x_pos = window_x_pos;
+    }
 }
 
+//-----------------------PRIVATE METHODS-------------------------------//
+void BackgroundDrawer::recomposite() {
+    renderer.SetTarget(composite);
+    renderer.SetDrawColor(0, 0, 0, 0);
+    renderer.Clear();
+    for (std::size_t index = 0; index < cached_layers_count; index++) {
+        layers_to_draw_behind.at(index).draw(background_type);
+    }
+    renderer.SetTarget();
+    composite_dirty = false;
+}
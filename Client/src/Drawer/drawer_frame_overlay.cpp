@@ -0,0 +1,38 @@
+#include "../../include/Drawer/drawer_frame_overlay.h"
+
+constexpr std::int32_t OVERLAY_X = 10;
+constexpr std::int32_t OVERLAY_Y = 10;
+constexpr std::int32_t OVERLAY_HEIGHT = 12;
+constexpr float PIXELS_PER_MS = 12;
+
+FrameOverlayDrawer::FrameOverlayDrawer(SDL2pp::Renderer &renderer) :
+    renderer(renderer),
+    phase_colors{
+        SDL2pp::Color(80, 160, 255, 255),   // eventos
+        SDL2pp::Color(255, 200, 50, 255),   // snapshot
+        SDL2pp::Color(120, 120, 120, 255),  // fondo
+        SDL2pp::Color(50, 255, 50, 255),    // actores
+        SDL2pp::Color(255, 80, 80, 255)     // present
+    },
+    background_color(0, 0, 0, 255),
+    budget_color(255, 255, 255, 255) {
+}
+
+void FrameOverlayDrawer::draw(const FramePacer &frame_pacer) {
+    auto frame_width = static_cast<std::int32_t>(frame_pacer.getFrameMs() * PIXELS_PER_MS);
+    renderer.SetDrawColor(background_color);
+    renderer.FillRect(SDL2pp::Rect(OVERLAY_X, OVERLAY_Y, frame_width, OVERLAY_HEIGHT));
+
+    std::int32_t phase_x = OVERLAY_X;
+    for (std::uint8_t phase = 0; phase < PHASE_LAST; phase++) {
+        auto phase_width = static_cast<std::int32_t>(
+                frame_pacer.getPhaseMs(static_cast<FramePhase>(phase)) * PIXELS_PER_MS);
+        renderer.SetDrawColor(phase_colors.at(phase));
+        renderer.FillRect(SDL2pp::Rect(phase_x, OVERLAY_Y, phase_width, OVERLAY_HEIGHT));
+        phase_x += phase_width;
+    }
+
+    auto budget_x = OVERLAY_X + static_cast<std::int32_t>(frame_pacer.getTargetFrameMs() * PIXELS_PER_MS);
+    renderer.SetDrawColor(budget_color);
+    renderer.FillRect(SDL2pp::Rect(budget_x, OVERLAY_Y - 2, 2, OVERLAY_HEIGHT + 4));
+}
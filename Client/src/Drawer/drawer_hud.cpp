@@ -0,0 +1,117 @@
+#include "../../include/Drawer/drawer_hud.h"
+
+constexpr std::int32_t BAR_WIDTH = 64;
+constexpr std::int32_t HEALTH_BAR_HEIGHT = 10;
+constexpr std::int32_t AMMO_BAR_HEIGHT = 4;
+// Posicion de la barra respecto del sprite (igual que el viejo HealthBarDrawer).
+constexpr std::int32_t BAR_OFFSET_X = 32 - 64;
+constexpr std::int32_t BAR_OFFSET_Y = 43 - 128;
+constexpr std::uint8_t STEPS = 100;
+
+static std::uint8_t quantize(std::uint16_t actual, std::uint16_t total) {
+    if (total == 0) {
+        return 0;
+    }
+    std::uint32_t step = static_cast<std::uint32_t>(actual) * STEPS / total;
+    return static_cast<std::uint8_t>(step > STEPS ? STEPS : step);
+}
+
+static std::int32_t stepWidth(std::uint8_t step) {
+    return BAR_WIDTH * step / STEPS;
+}
+
+HudDrawer::HudDrawer(SDL2pp::Renderer &renderer) :
+    renderer(renderer),
+    background_color(0, 0, 0, 255),
+    health_color(50, 255, 50, 255),
+    ammo_color(255, 200, 50, 255),
+    entries(),
+    background_quads(),
+    health_quads(),
+    ammo_quads(),
+    quad_entries(),
+    quads_dirty(false) {
+}
+
+void HudDrawer::updateActor(std::uint16_t actor_id, const ElementStateDTO &actor_state,
+                            const SDL2pp::Point &sprite_destination) {
+    HudEntry updated {quantize(actor_state.actual_health, actor_state.health),
+                      quantize(actor_state.actual_ammo, actor_state.ammo),
+                      sprite_destination, true};
+
+    auto entry = entries.find(actor_id);
+    if (entry == entries.end()) {
+        entries.emplace(actor_id, updated);
+        quads_dirty = true;
+        return;
+    }
+    HudEntry& current = entry->second;
+    if (current.health_step != updated.health_step || current.ammo_step != updated.ammo_step ||
+        !current.visible) {
+        quads_dirty = true;
+    }
+    current = updated;
+}
+
+void HudDrawer::hideActor(std::uint16_t actor_id) {
+    auto entry = entries.find(actor_id);
+    if (entry != entries.end() && entry->second.visible) {
+        entry->second.visible = false;
+        quads_dirty = true;
+    }
+}
+
+void HudDrawer::removeActor(std::uint16_t actor_id) {
+    if (entries.erase(actor_id) > 0) {
+        quads_dirty = true;
+    }
+}
+
+void HudDrawer::draw() {
+    if (quads_dirty) {
+        rebuildQuads();
+    }
+    placeQuads();
+    fillQuads(background_color, background_quads);
+    fillQuads(health_color, health_quads);
+    fillQuads(ammo_color, ammo_quads);
+}
+
+//-----------------------PRIVATE METHODS-------------------------------//
+void HudDrawer::rebuildQuads() {
+    background_quads.clear();
+    health_quads.clear();
+    ammo_quads.clear();
+    quad_entries.clear();
+    for (const auto& pair_id_entry : entries) {
+        const HudEntry& entry = pair_id_entry.second;
+        if (!entry.visible) {
+            continue;
+        }
+        // el tamaño depende de los valores, la posicion la pone placeQuads
+        background_quads.emplace_back(0, 0, BAR_WIDTH, HEALTH_BAR_HEIGHT + AMMO_BAR_HEIGHT);
+        health_quads.emplace_back(0, 0, stepWidth(entry.health_step), HEALTH_BAR_HEIGHT);
+        ammo_quads.emplace_back(0, 0, stepWidth(entry.ammo_step), AMMO_BAR_HEIGHT);
+        quad_entries.push_back(&entry);
+    }
+    quads_dirty = false;
+}
+
+void HudDrawer::placeQuads() {
+    for (std::size_t i = 0; i < quad_entries.size(); ++i) {
+        const SDL2pp::Point& anchor = quad_entries[i]->anchor;
+        std::int32_t bar_x = anchor.GetX() + BAR_OFFSET_X;
+        std::int32_t bar_y = anchor.GetY() + BAR_OFFSET_Y;
+        background_quads[i].SetX(bar_x).SetY(bar_y);
+        health_quads[i].SetX(bar_x).SetY(bar_y);
+        ammo_quads[i].SetX(bar_x).SetY(bar_y + HEALTH_BAR_HEIGHT);
+    }
+}
+
+void HudDrawer::fillQuads(const SDL2pp::Color &color, const std::vector<SDL2pp::Rect> &quads) {
+    if (quads.empty()) {
+        return;
+    }
+    renderer.SetDrawColor(color);
+    renderer.FillRects(quads.data(), static_cast<int>(quads.size()));
+}
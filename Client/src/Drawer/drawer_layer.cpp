@@ -1,6 +1,7 @@
 //
 // Created by luan on 23/06/23.
 //
+#include <initializer_list>
 #include "../../include/Drawer/drawer_layer.h"
 
 LayerDrawer::LayerDrawer(BackgroundManager &background_manager, std::uint8_t layer_type, double speed,
@@ -19,9 +20,16 @@ void LayerDrawer::draw(std::uint8_t background_type) {
     SDL2pp::Rect layer_2 = {x2, 0, width, height};
     SDL2pp::Rect layer_3 = {x3, 0, width, height};
 
-    background_manager.drawLayer(background_type, layer_type, layer_1);
-    background_manager.drawLayer(background_type, layer_type, layer_2);
-    background_manager.drawLayer(background_type, layer_type, layer_3);
+    // De las tres copias como mucho dos tocan la ventana, el resto no se copia.
+    for (const SDL2pp::Rect& layer : {layer_1, layer_2, layer_3}) {
+        if (layer.GetX() + width > 0 && layer.GetX() < width) {
+            background_manager.drawLayer(background_type, layer_type, layer);
+        }
+    }
+}
+
+double LayerDrawer::getSpeed() const {
+    return speed;
 }
 
 void LayerDrawer::updateInfo(std::int32_t window_x_pos, std::int32_t window_width, std::int32_t window_height) {
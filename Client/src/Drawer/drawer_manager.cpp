@@ -3,31 +3,55 @@
 //
 #include "../../include/Drawer/drawer_manager.h"
 
+constexpr std::int32_t BUCKET_WIDTH = 256;
+// Igual que la tolerancia de ActorDrawer, para no cortar sprites en los bordes.
+constexpr std::int32_t VIEW_TOLERANCE = 200;
+
+static std::int32_t bucketOf(std::int32_t position_x) {
+    // Division con piso, para que las x negativas no caigan en el bucket 0.
+    std::int32_t bucket = position_x / BUCKET_WIDTH;
+    if (position_x < 0 && position_x % BUCKET_WIDTH != 0) {
+        bucket--;
+    }
+    return bucket;
+}
+
 DrawerManager::DrawerManager(SDL2pp::Renderer &renderer) :
     animation_manager(renderer),
-    renderer(renderer),
-    actor_drawers() {
+    actor_drawers(),
+    hud_drawer(renderer),
+    x_buckets(),
+    actor_buckets(),
+    first_visible_bucket(0),
+    last_visible_bucket(0),
+    updated_actors() {
 }
 
 
 void DrawerManager::draw(std::uint32_t frame_ticks) {
-    for (auto & pair_id_actor : actor_drawers) {
-        ActorDrawer& actor_drawer = pair_id_actor.second;
-        // if (pair_id_actor.first == 1) {
-        //     std::cout << "id: " << pair_id_actor.first << "\n";
-        //     std::cout << "x: " << pair_id_actor.second.position_x << "\n";
-        //     std::cout << "y: " << pair_id_actor.second.position_y << "\n";
-        //     std::cout << "type: " << unsigned(pair_id_actor.second.type) << "\n";
-        //     std::cout << "vida: " << pair_id_actor.second.health << "\n";
-        //     std::cout << "vida actual: " << pair_id_actor.second.actual_health << "\n";
-        //     std::cout << "ammo: " << pair_id_actor.second.ammo << "\n";
-        //     std::cout << "ammo actual: " << pair_id_actor.second.actual_ammo << "\n";
-        //     std::cout << "tiempo: " << unsigned(pair_id_actor.second.timeleft) << "\n";
-        //     std::cout << "-----------------------------------------" << "\n";
-        // }
-        actor_drawer.draw(frame_ticks);
-        if (pair_id_actor.first < 100) {
-            actor_drawer.drawBar();
+    auto bucket = x_buckets.lower_bound(first_visible_bucket);
+    auto last_bucket = x_buckets.upper_bound(last_visible_bucket);
+    for (; bucket != last_bucket; ++bucket) {
+        for (std::uint16_t actor_id : bucket->second) {
+            actor_drawers.at(actor_id).draw(frame_ticks);
+        }
+    }
+    // Todas las barras juntas, arriba de los actores.
+    hud_drawer.draw();
+}
+
+void DrawerManager::beginUpdate(std::int32_t window_x_pos, std::int32_t window_width) {
+    first_visible_bucket = bucketOf(window_x_pos - VIEW_TOLERANCE);
+    last_visible_bucket = bucketOf(window_x_pos + window_width + VIEW_TOLERANCE);
+    updated_actors.clear();
+}
+
+void DrawerManager::endUpdate() {
+    for (auto actor = actor_drawers.begin(); actor != actor_drawers.end();) {
+        std::uint16_t actor_id = actor->first;
+        ++actor;
+        if (updated_actors.count(actor_id) == 0) {
+            removeActor(actor_id);
         }
     }
 }
@@ -35,32 +59,76 @@ void DrawerManager::draw(std::uint32_t frame_ticks) {
 void
 DrawerManager::updateInfo(std::uint16_t actor_id, const ElementStateDTO &actor_state, std::int32_t window_x_pos,
                           std::int32_t window_width, std::int32_t window_height) {
+    updated_actors.insert(actor_id);
+    if (actor_state.is_dead == 1) {
+        removeActor(actor_id);
+        return;
+    }
+
+    std::int32_t bucket = bucketOf(actor_state.position_x);
     auto pair_id_actor_ptr = actor_drawers.find(actor_id);
     if (pair_id_actor_ptr == actor_drawers.end()) {
-        pair_id_actor_ptr = addActor(actor_id, actor_state, window_x_pos, window_width, window_height);
-    } else {
-        ActorDrawer& found_actor = pair_id_actor_ptr->second;
-        found_actor.updateInfo(actor_state, window_x_pos, window_width, window_height);
+        pair_id_actor_ptr = addActor(actor_id, bucket);
+    }
+    std::int32_t& actor_bucket = actor_buckets.at(actor_id);
+    if (actor_bucket != bucket) {
+        moveActor(actor_id, actor_bucket, bucket);
+    }
 
+    // Los que estan fuera de la ventana solo se reubican en el indice: draw
+    // no los visita y se actualizan completos cuando vuelven a entrar.
+    bool is_soldier = actor_id < 100;
+    if (isVisible(bucket)) {
+        ActorDrawer& actor_drawer = pair_id_actor_ptr->second;
+        actor_drawer.updateInfo(actor_state, window_x_pos, window_width, window_height);
+        if (is_soldier) {
+            hud_drawer.updateActor(actor_id, actor_state, actor_drawer.getSpriteDestination());
+        }
+    } else if (is_soldier) {
+        hud_drawer.hideActor(actor_id);
     }
-    if (actor_state.is_dead == 1) {
-        actor_drawers.erase(pair_id_actor_ptr);
+}
+
+void DrawerManager::removeActor(std::uint16_t actor_id) {
+    auto actor_bucket = actor_buckets.find(actor_id);
+    if (actor_bucket == actor_buckets.end()) {
+        return;
+    }
+    auto bucket = x_buckets.find(actor_bucket->second);
+    bucket->second.erase(actor_id);
+    if (bucket->second.empty()) {
+        x_buckets.erase(bucket);
     }
+    actor_buckets.erase(actor_bucket);
+    actor_drawers.erase(actor_id);
+    hud_drawer.removeActor(actor_id);
 }
 
 
 //-----------------------PRIVATE METHODS-------------------------------//
 std::_Rb_tree_iterator<std::pair<const uint16_t, ActorDrawer>>
-DrawerManager::addActor(std::uint16_t actor_id, const ElementStateDTO &actor_state, std::int32_t window_x_pos,
-                        std::int32_t window_width, std::int32_t window_height) {
+DrawerManager::addActor(std::uint16_t actor_id, std::int32_t bucket) {
     auto res = actor_drawers.emplace(
-            actor_id, ActorDrawer(animation_manager, renderer));
+            actor_id, ActorDrawer(animation_manager));
     if (!res.second) {
         throw std::runtime_error("DrawerManager::updateInfo. Attempt to "
                                  "insert new actor failed!.\n");
     }
-    ActorDrawer& added_actor = res.first->second;
-    added_actor.updateInfo(actor_state, window_x_pos, window_width, window_height);
+    actor_buckets.emplace(actor_id, bucket);
+    x_buckets[bucket].insert(actor_id);
     return res.first;
 }
 
+void DrawerManager::moveActor(std::uint16_t actor_id, std::int32_t &actor_bucket, std::int32_t bucket) {
+    auto old_bucket = x_buckets.find(actor_bucket);
+    old_bucket->second.erase(actor_id);
+    if (old_bucket->second.empty()) {
+        x_buckets.erase(old_bucket);
+    }
+    x_buckets[bucket].insert(actor_id);
+    actor_bucket = bucket;
+}
+
+bool DrawerManager::isVisible(std::int32_t bucket) const {
+    return bucket >= first_visible_bucket && bucket <= last_visible_bucket;
+}
@@ -12,21 +12,30 @@
 #include "../../../Common/include/Information/Requests/pick_soldier_scout.h"
 #include "../../../Common/include/Information/Actions/game_create.h"
 #include "../../../Common/include/Information/feedback_server_creategame.h"
+#include "../../../Common/include/Information/feedback_server_gamelist.h"
+#include "../../../Common/include/Information/Requests/list_games.h"
+#include "../../../Common/include/Information/Requests/quick_match.h"
 
 enum Page : std::uint8_t {
     PAGE_MAIN,
     PAGE_GAMECODE,
     PAGE_PICKSOLDIER,
     PAGE_PICKGAMETYPE,
-    PAGE_PICKGAMEDIFF
+    PAGE_PICKGAMEDIFF,
+    PAGE_WAITING
 };
 
+// cada cuanto se mira si llego la respuesta a la partida rapida
+constexpr int QUICK_MATCH_POLL_MS = 100;
+
 LobbyWindow::LobbyWindow(Queue<std::shared_ptr<Information>> &actions_to_send,
                          Queue<std::shared_ptr<Information>> &feedback_received, bool *joined, QWidget *parent) :
                          QWidget(parent),
                          actions_to_send(actions_to_send),
                          feedback_received(feedback_received),
                          joined(joined),
+                         quick_match(false),
+                         quick_match_timer(this),
                          red_palette(),
                          green_palette(),
                          white_palette(),
@@ -35,6 +44,8 @@ LobbyWindow::LobbyWindow(Queue<std::shared_ptr<Information>> &actions_to_send,
     ui->setupUi(this);
     ui->lineEdit_gamecode->setValidator(new QIntValidator(1000000, 9999999, this));
     ui->stackedWidget->setCurrentIndex(PAGE_MAIN);
+    quick_match_timer.setInterval(QUICK_MATCH_POLL_MS);
+    connect(&quick_match_timer, &QTimer::timeout, this, &LobbyWindow::poll_quick_match);
     red_palette.setColor(QPalette::Base, Qt::red);
     green_palette.setColor(QPalette::Base, Qt::green);
     white_palette.setColor(QPalette::Base, Qt::white);
@@ -53,6 +64,13 @@ LobbyWindow::~LobbyWindow()
 
 void LobbyWindow::on_pushButton_creategame_clicked()
 {
+    quick_match = false;
+    ui->stackedWidget->setCurrentIndex(PAGE_PICKGAMETYPE);
+}
+
+void LobbyWindow::on_pushButton_quickmatch_clicked()
+{
+    quick_match = true;
     ui->stackedWidget->setCurrentIndex(PAGE_PICKGAMETYPE);
 }
 
@@ -148,17 +166,71 @@ void LobbyWindow::on_pushButton_insane_clicked()
 }
 
 void LobbyWindow::create_game_process() {
+    if (quick_match) {
+        quick_match_process();
+        return;
+    }
     ui->stackedWidget->setCurrentIndex(PAGE_GAMECODE);
     actions_to_send.push(std::make_shared<CreateGameAction>(game_type, game_difficulty));
     const auto& feed = feedback_received.pop();
+    if (feed->get_type() == FEEDBACK_SERVER_FULL) {
+        // no hay lugar para otra partida, todavia se puede unir a una
+        ui->stackedWidget->setCurrentIndex(PAGE_MAIN);
+        return;
+    }
     std::uint32_t game_code = dynamic_cast<CreateGameFeedback&>(*feed).game_code;
     ui->lineEdit_gamecoderecv->setText(QString::number(game_code));
 
 }
 
 
+void LobbyWindow::quick_match_process() {
+    // el servidor responde cuando arma el grupo o encuentra una partida abierta
+    actions_to_send.push(std::make_shared<QuickMatchRequest>(game_type, game_difficulty));
+    ui->stackedWidget->setCurrentIndex(PAGE_WAITING);
+    quick_match_timer.start();
+}
+
+void LobbyWindow::poll_quick_match() {
+    std::shared_ptr<Information> feed;
+    try {
+        if (!feedback_received.try_pop(feed)) return;
+    } catch (const ClosedQueue& e) {
+        // se corto la conexion mientras esperaba
+        quick_match_timer.stop();
+        this->close();
+        return;
+    }
+    quick_match_timer.stop();
+    bool joined_game = feed->get_type() == FEEDBACK_CREATE_GAME ||
+                       (feed->get_type() == FEEDBACK_JOIN_GAME &&
+                        dynamic_cast<JoinGameFeedback&>(*feed).joined == JOINED);
+    ui->stackedWidget->setCurrentIndex(joined_game ? PAGE_PICKSOLDIER : PAGE_MAIN);
+}
+
+
 void LobbyWindow::on_pushButton_clicked()
 {
     ui->stackedWidget->setCurrentIndex(PAGE_PICKSOLDIER);
 }
 
+void LobbyWindow::on_pushButton_refreshgames_clicked()
+{
+    actions_to_send.push(std::make_shared<ListGamesRequest>(VOID, VOID));
+    const auto& feed = feedback_received.pop();
+    const auto& list_feed = dynamic_cast<GameListFeedback&>(*feed);
+    ui->comboBox_opengames->clear();
+    for (const GameSummaryDTO& game : list_feed.games) {
+        QString mode = (game.mode == SURVIVAL) ? "Survival" : "Clear the zone";
+        ui->comboBox_opengames->addItem(
+            QString("%1 - %2 (%3/%4)").arg(game.game_code).arg(mode)
+                .arg(game.players).arg(game.max_players),
+            QVariant(game.game_code));
+    }
+}
+
+void LobbyWindow::on_comboBox_opengames_activated(int index)
+{
+    // la elegida queda lista para unirse con Join Game
+    ui->lineEdit_gamecode->setText(ui->comboBox_opengames->itemData(index).toString());
+}
@@ -3,6 +3,7 @@
 
 #include <QWidget>
 #include <QPushButton>
+#include <QTimer>
 #include "../../../Common/include/Information/information.h"
 #include "../../../libs/queue.h"
 
@@ -25,6 +26,8 @@ private slots:
 
     void on_pushButton_creategame_clicked();
 
+    void on_pushButton_quickmatch_clicked();
+
     void on_pushButton_joingame_clicked();
 
     void on_pushButton_p90soldier_clicked();
@@ -49,6 +52,12 @@ private slots:
 
     void on_pushButton_clicked();
 
+    void on_pushButton_refreshgames_clicked();
+
+    void on_comboBox_opengames_activated(int index);
+
+    void poll_quick_match();
+
 private:
     Queue<std::shared_ptr<Information>>& actions_to_send;
     Queue<std::shared_ptr<Information>>& feedback_received;
@@ -56,6 +65,10 @@ private:
     std::uint8_t game_difficulty;
     std::uint8_t soldier_type;
     bool* joined;
+    // el modo y la dificultad elegidos son para una partida rapida
+    bool quick_match;
+    // mientras el servidor arma el grupo se revisa la respuesta sin bloquear la ventana
+    QTimer quick_match_timer;
     QPalette red_palette;
     QPalette green_palette;
     QPalette white_palette;
@@ -63,6 +76,8 @@ private:
 
     void create_game_process();
 
+    void quick_match_process();
+
 };
 
 #endif // LOBBYWINDOW_H
@@ -1,14 +1,24 @@
 #include "../include/client.h"
+#include "../include/config_game.h"
+#include "../../Common/include/Information/Requests/compression.h"
 
 Client::Client(int argc, char **argv) :
     socket(argv[1], argv[2]) ,
     actions_to_send(5000),
     feedback_received(10000),
     sender(actions_to_send, socket),
-    receiver(feedback_received, socket),
+    receiver(feedback_received, socket, argv[1]),
     lobby(actions_to_send, feedback_received, argc, argv),
     client_game(actions_to_send, feedback_received) {
-
+    // los comandos son chicos: sin Nagle salen apenas se apreta una tecla
+    GameConfig config;
+    SocketOptions options;
+    options.no_delay = config.tcp_nodelay;
+    socket.applyOptions(options);
+    // sale antes que cualquier pedido del lobby
+    if (config.compression) {
+        actions_to_send.push(std::make_shared<CompressionRequest>(COMPRESSION_DEFLATE));
+    }
 }
 
 void Client::start() {
@@ -6,6 +6,12 @@
 GameConfig::GameConfig() :
         config(YAML::LoadFile(CLIENT_CONFIG_PATH "/config.yaml")),
         window_width(config["window"]["width"].as<std::uint16_t>()),
-        window_height(config["window"]["height"].as<std::uint16_t>()){
+        window_height(config["window"]["height"].as<std::uint16_t>()),
+        target_fps(config["frame"]["target_fps"].as<std::uint16_t>()),
+        vsync(config["frame"]["vsync"].as<bool>()),
+        frame_overlay(config["frame"]["overlay"].as<bool>()),
+        use_datagrams(config["network"]["udp"].as<bool>()),
+        tcp_nodelay(config["network"]["nodelay"].as<bool>()),
+        compression(config["network"]["compression"].as<bool>()) {
 }
 
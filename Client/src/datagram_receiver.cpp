@@ -0,0 +1,84 @@
+#include <netinet/in.h>
+#include <cstring>
+#include "../include/datagram_receiver.h"
+#include "../include/protocol.h"
+#include "../../Common/include/Information/information_code.h"
+#include "../../Common/include/Socket/socket_buffer.h"
+
+// un datagrama UDP no puede ser mas grande
+constexpr std::size_t MAX_DATAGRAM = 65536;
+// seq de 4 bytes antes del snapshot
+constexpr std::size_t DATAGRAM_HEADER = 4;
+// cada cuanto se revisa si hay que cortar y se reintenta el saludo
+constexpr int POLL_MS = 100;
+
+DatagramReceiver::DatagramReceiver(Queue<std::shared_ptr<Information>> &feedback_received,
+                                   const std::string& hostname, std::uint16_t port,
+                                   std::uint32_t token) :
+        feedback_received(feedback_received),
+        socket(hostname.c_str(), std::to_string(port).c_str()),
+        token(token),
+        last_sequence(0),
+        has_sequence(false),
+        buffer(MAX_DATAGRAM),
+        is_running(true),
+        keep_receiving(true) {
+}
+
+void DatagramReceiver::sendHello() {
+    std::uint32_t bigendian_token = htonl(token);
+    socket.sendDatagram(&bigendian_token, sizeof(bigendian_token));
+}
+
+void DatagramReceiver::run() {
+    using std::cerr;
+    using std::endl;
+
+    try {
+    sendHello();
+    while (keep_receiving) {
+        std::size_t received = socket.recvDatagram(buffer.data(), buffer.size(), POLL_MS);
+        if (received == 0) {
+            // el saludo tambien puede perderse: insisto hasta que llegue algo
+            if (!has_sequence) sendHello();
+            continue;
+        }
+        if (received <= DATAGRAM_HEADER) continue;
+
+        std::uint32_t bigendian_sequence;
+        std::memcpy(&bigendian_sequence, buffer.data(), DATAGRAM_HEADER);
+        std::uint32_t sequence = ntohl(bigendian_sequence);
+        // llego tarde: ya se mostro uno mas nuevo
+        if (has_sequence && !DatagramSocket::isNewer(sequence, last_sequence)) continue;
+
+        BufferSocket datagram(buffer.data() + DATAGRAM_HEADER, received - DATAGRAM_HEADER);
+        Protocol protocol(datagram);
+        std::shared_ptr<Information> feed;
+        try {
+            feed = protocol.recvFeedback();
+        } catch (const ClosedSocket& err) {
+            continue;  // datagrama cortado, se descarta
+        }
+        if (feed == nullptr || feed->get_type() != FEEDBACK_GAME_STATE) continue;
+        last_sequence = sequence;
+        has_sequence = true;
+        feedback_received.push(feed);
+    }
+    } catch (const ClosedQueue& err) {
+        keep_receiving = false;
+    } catch (const std::exception& e) {
+        cerr << "An exception was caught in DatagramReceiver thread: "
+             << e.what() << endl;
+    } catch (...) {
+        cerr << "An unknown exception was caught in DatagramReceiver thread." << endl;
+    }
+    is_running = false;
+}
+
+void DatagramReceiver::stop() {
+    keep_receiving = false;
+}
+
+bool DatagramReceiver::isDead() const {
+    return !is_running;
+}
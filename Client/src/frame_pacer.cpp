@@ -0,0 +1,74 @@
+#include <SDL2/SDL.h>
+#include "../include/frame_pacer.h"
+
+// Cuanto pesa la ultima medicion en el promedio.
+constexpr float SMOOTHING = 0.1;
+// SDL_Delay puede pasarse ~1ms, lo ultimo se espera activamente.
+constexpr std::uint32_t SPIN_MARGIN_MS = 1;
+
+static float smooth(float average, float sample) {
+    return average + (sample - average) * SMOOTHING;
+}
+
+FramePacer::FramePacer(std::uint16_t target_fps, bool vsync) :
+        counter_frequency(SDL_GetPerformanceFrequency()),
+        counter_per_frame(counter_frequency / (target_fps > 0 ? target_fps : 60)),
+        vsync(vsync),
+        frame_deadline(SDL_GetPerformanceCounter()),
+        frame_start(frame_deadline),
+        lap_start(frame_deadline),
+        phase_ms{},
+        frame_ms(0) {
+}
+
+void FramePacer::beginFrame() {
+    std::uint64_t now = SDL_GetPerformanceCounter();
+    auto elapsed_ms = static_cast<float>(now - frame_start) * 1000 / static_cast<float>(counter_frequency);
+    frame_ms = smooth(frame_ms, elapsed_ms);
+    frame_start = now;
+    lap_start = now;
+}
+
+void FramePacer::lap(FramePhase phase) {
+    std::uint64_t now = SDL_GetPerformanceCounter();
+    auto elapsed_ms = static_cast<float>(now - lap_start) * 1000 / static_cast<float>(counter_frequency);
+    phase_ms.at(phase) = smooth(phase_ms.at(phase), elapsed_ms);
+    lap_start = now;
+}
+
+void FramePacer::waitNextFrame() {
+    // Con vsync el Present ya espero al monitor.
+    if (vsync) {
+        return;
+    }
+    frame_deadline += counter_per_frame;
+    std::uint64_t now = SDL_GetPerformanceCounter();
+
+    if (now >= frame_deadline) {
+        // Si el frame se paso por mas de un periodo no se intenta recuperar,
+        // sino se encadenan frames sin espera.
+        if (now - frame_deadline > counter_per_frame) {
+            frame_deadline = now;
+        }
+        return;
+    }
+
+    std::uint64_t remaining_ms = (frame_deadline - now) * 1000 / counter_frequency;
+    if (remaining_ms > SPIN_MARGIN_MS) {
+        SDL_Delay(static_cast<std::uint32_t>(remaining_ms - SPIN_MARGIN_MS));
+    }
+    while (SDL_GetPerformanceCounter() < frame_deadline) {
+    }
+}
+
+float FramePacer::getPhaseMs(FramePhase phase) const {
+    return phase_ms.at(phase);
+}
+
+float FramePacer::getFrameMs() const {
+    return frame_ms;
+}
+
+float FramePacer::getTargetFrameMs() const {
+    return static_cast<float>(counter_per_frame) * 1000 / static_cast<float>(counter_frequency);
+}
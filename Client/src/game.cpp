@@ -2,19 +2,26 @@
 // Created by luan on 17/06/23.
 //
 #include "../include/game.h"
+#include <cstdlib>
 #include <iostream>
+#include "../../Common/include/Information/Actions/view_hint.h"
 
-constexpr uint32_t MS_PER_FRAME = 16;
+// Cuanto se tiene que mover la camara para mandar un nuevo hint al server.
+constexpr std::int32_t VIEW_HINT_STEP = 128;
 
 ClientGame::ClientGame(
         Queue<std::shared_ptr<Information>>& actions_to_send,
         Queue<std::shared_ptr<Information>>& feedback_received) :
         config(),
-        game_visual(config.window_width, config.window_height),
+        game_visual(config.window_width, config.window_height, config.vsync),
         game_music(),
+        actions_to_send(actions_to_send),
         feedback_received(feedback_received),
         quit(false),
-        event_handler(actions_to_send, &quit, game_music) {
+        show_frame_overlay(config.frame_overlay),
+        event_handler(actions_to_send, &quit, &show_frame_overlay, game_music),
+        frame_pacer(config.target_fps, config.vsync),
+        last_view_hint_x(0) {
 }
 
 void ClientGame::launch(ClientLobby &lobby) {
@@ -25,13 +32,24 @@ void ClientGame::launch(ClientLobby &lobby) {
     game_music.startMusic();
     while (!quit)
     {
-        uint32_t start_milliseconds = SDL_GetTicks();
+        frame_pacer.beginFrame();
+        // Los ticks en ms alcanzan para las animaciones.
+        uint32_t frame_ticks = SDL_GetTicks();
 
         event_handler.start();
+        frame_pacer.lap(PHASE_EVENTS);
 
         game_visual.clear();
 
-        while(feedback_received.try_pop(information_ptr));
+        // Se dibuja solo el ultimo estado, pero las salidas de los anteriores
+        // se aplican igual para no dejar actores fantasma.
+        std::shared_ptr<Information> next_information_ptr = nullptr;
+        while(feedback_received.try_pop(next_information_ptr)) {
+            if (information_ptr != nullptr && information_ptr->get_type() == FEEDBACK_GAME_STATE) {
+                game_visual.removeLeftActors(dynamic_cast<GameStateFeedback&>(*information_ptr));
+            }
+            information_ptr = next_information_ptr;
+        }
 
         if (information_ptr != nullptr) {
             if (information_ptr->get_type() == FEEDBACK_GAME_SCORE) {
@@ -41,18 +59,35 @@ void ClientGame::launch(ClientLobby &lobby) {
             } else {
                 game_visual.updateInfo(dynamic_cast<GameStateFeedback&>
                         (*information_ptr));
+                sendViewHint();
             }
         }
-        game_visual.draw(start_milliseconds);
+        frame_pacer.lap(PHASE_SNAPSHOT);
+
+        game_visual.drawBackground();
+        frame_pacer.lap(PHASE_BACKGROUND);
+
+        game_visual.drawActors(frame_ticks);
+        frame_pacer.lap(PHASE_ACTORS);
+
+        if (show_frame_overlay) {
+            game_visual.drawFrameOverlay(frame_pacer);
+        }
 
         game_visual.present();
+        frame_pacer.lap(PHASE_PRESENT);
 
         information_ptr = nullptr;
 
-        uint32_t end_milliseconds = SDL_GetTicks();
-        
-        if (end_milliseconds - start_milliseconds < MS_PER_FRAME) {
-            SDL_Delay(MS_PER_FRAME - end_milliseconds + start_milliseconds);
-        }
+        frame_pacer.waitNextFrame();
+    }
+}
+
+void ClientGame::sendViewHint() {
+    std::int32_t window_x = game_visual.getWindowX();
+    if (std::abs(window_x - last_view_hint_x) < VIEW_HINT_STEP) {
+        return;
     }
+    last_view_hint_x = window_x;
+    actions_to_send.push(std::make_shared<ViewHintAction>(window_x, game_visual.getWindowWidth()));
 }
@@ -27,10 +27,11 @@
 
 EventHandler::EventHandler(
         Queue<std::shared_ptr<Information>> &actions_to_send,
-        bool *quit, GameMusic& game_music) :
+        bool *quit, bool *show_frame_overlay, GameMusic& game_music) :
         actions_to_send(actions_to_send),
         game_music(game_music),
         quit(quit),
+        show_frame_overlay(show_frame_overlay),
         event() ,
         keydown({nullptr}),
         keyup({nullptr}) {
@@ -84,6 +85,9 @@ void EventHandler::processEvent() const {
         } else if (event.key.keysym.sym == SDLK_m) {
             game_music.changeMusicStatus();
             return;
+        } else if (event.key.keysym.sym == SDLK_F3) {
+            *show_frame_overlay = !*show_frame_overlay;
+            return;
         }
 
         const shared_ptr<Information>& action_to_send =
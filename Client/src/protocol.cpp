@@ -2,9 +2,18 @@
 #include "../include/protocol.h"
 #include "../../Common/include/Information/information_code.h"
 #include "../../Common/include/Information/feedback_server_joingame.h"
+#include "../../Common/include/Information/feedback_server_datagramoffer.h"
+#include "../../Common/include/Information/feedback_server_compression.h"
+#include "../../Common/include/Information/feedback_server_full.h"
+#include "../../Common/include/Information/feedback_server_gamelist.h"
+#include "../../Common/include/Socket/socket_buffer.h"
 #include <iostream>
 
 #define RECV_DATA(var) socket.recvData(&var, sizeof(var))
+// un snapshot compacto mas grande que esto es basura
+constexpr std::uint32_t MAX_COMPACT_PAYLOAD = 1 << 24;
+// lo mismo para un mensaje comprimido, antes y despues de descomprimir
+constexpr std::uint32_t MAX_COMPRESSED_FRAME = 1 << 24;
 //------------------------PRIVATE METHODS-----------------------------------//
 
 std::shared_ptr<Information> Protocol::builtCreateGameFeedback() {
@@ -52,7 +61,20 @@ std::shared_ptr<Information> Protocol::builtGameStateFeedback() {
 
         actors.emplace_back(actor_id, std::move(actor_state));
     }
-    return make_shared<GameStateFeedback>(std::move(actors));
+
+    uint16_t bigendian_left_amount = 0;
+    RECV_DATA(bigendian_left_amount);
+    uint16_t left_amount = ntohs(bigendian_left_amount);
+
+    vector<uint16_t> left_actors;
+    left_actors.reserve(left_amount);
+
+    for (size_t counter = 0; counter < left_amount; counter++) {
+        uint16_t bigendian_actor_id;
+        RECV_DATA(bigendian_actor_id);
+        left_actors.push_back(ntohs(bigendian_actor_id));
+    }
+    return make_shared<GameStateFeedback>(std::move(actors), std::move(left_actors));
 }
 
 ElementStateDTO Protocol::recvActorState() {
@@ -136,8 +158,103 @@ ScoreDTO Protocol::recvScore() {
 
 }
 
+std::shared_ptr<Information> Protocol::builtCompactGameStateFeedback() {
+    using std::uint8_t;
+    using std::uint32_t;
+
+    uint8_t version;
+    RECV_DATA(version);
+
+    // largo del payload como varint, byte a byte
+    uint32_t payload_size = 0;
+    uint8_t byte = 0x80;
+    for (unsigned int shift = 0; (byte & 0x80) != 0; shift += 7) {
+        if (shift > 28) {
+            throw std::runtime_error("Protocol::builtCompactGameStateFeedback. Invalid size.\n");
+        }
+        RECV_DATA(byte);
+        payload_size |= static_cast<uint32_t>(byte & 0x7F) << shift;
+    }
+    if (payload_size > MAX_COMPACT_PAYLOAD) {
+        throw std::runtime_error("Protocol::builtCompactGameStateFeedback. Payload too big.\n");
+    }
+    std::vector<int8_t> payload(payload_size);
+    socket.recvData(payload.data(), payload.size());
+    return GameStateFeedback::fromCompact(version, payload);
+}
+
+std::shared_ptr<Information> Protocol::builtDatagramOfferFeedback() {
+    uint16_t bigendian_port;
+    uint32_t bigendian_token;
+
+    RECV_DATA(bigendian_port);
+    RECV_DATA(bigendian_token);
+    return std::make_shared<DatagramOfferFeedback>(ntohs(bigendian_port), ntohl(bigendian_token));
+}
+
+std::shared_ptr<Information> Protocol::builtCompressionFeedback() {
+    uint8_t codec;
+    RECV_DATA(codec);
+    return std::make_shared<CompressionFeedback>(codec);
+}
+
+std::shared_ptr<Information> Protocol::builtCompressedFeedback() {
+    uint32_t bigendian_compressed_size;
+    uint32_t bigendian_raw_size;
+
+    RECV_DATA(bigendian_compressed_size);
+    RECV_DATA(bigendian_raw_size);
+    uint32_t compressed_size = ntohl(bigendian_compressed_size);
+    uint32_t raw_size = ntohl(bigendian_raw_size);
+    if (compressed_size > MAX_COMPRESSED_FRAME || raw_size > MAX_COMPRESSED_FRAME) {
+        throw std::runtime_error("Protocol::builtCompressedFeedback. Frame too big.\n");
+    }
+    compressed.resize(compressed_size);
+    socket.recvData(compressed.data(), compressed.size());
+    if (!inflater) inflater.reset(new FrameInflater());
+    inflater->decompress(compressed.data(), compressed.size(), raw_size, inflated);
+
+    // adentro hay un mensaje comun (nunca otro comprimido)
+    BufferSocket frame(inflated.data(), inflated.size());
+    Protocol frame_protocol(frame);
+    return frame_protocol.recvFeedback();
+}
+
+std::shared_ptr<Information> Protocol::builtServerFullFeedback() {
+    uint8_t reason;
+    RECV_DATA(reason);
+    return std::make_shared<ServerFullFeedback>(reason);
+}
+
+std::shared_ptr<Information> Protocol::builtGameListFeedback() {
+    using std::uint16_t;
+    using std::uint32_t;
+
+    uint16_t bigendian_amount;
+    RECV_DATA(bigendian_amount);
+    uint16_t amount = ntohs(bigendian_amount);
+
+    std::vector<GameSummaryDTO> games;
+    games.reserve(amount);
+    for (uint16_t counter = 0; counter < amount; counter++) {
+        uint32_t bigendian_game_code;
+        RECV_DATA(bigendian_game_code);
+        GameSummaryDTO game{ntohl(bigendian_game_code), 0, 0, 0, 0};
+        RECV_DATA(game.mode);
+        RECV_DATA(game.difficulty);
+        RECV_DATA(game.players);
+        RECV_DATA(game.max_players);
+        games.push_back(game);
+    }
+    return std::make_shared<GameListFeedback>(std::move(games));
+}
+
 //------------------------PUBLIC METHODS------------------------------------//
-Protocol::Protocol(GameSocket& socket) : socket(socket) {
+Protocol::Protocol(Socket& socket) :
+    socket(socket),
+    inflater(nullptr),
+    compressed(),
+    inflated() {
 }
 
 void Protocol::sendAction(const Information &action) {
@@ -155,8 +272,20 @@ void Protocol::sendAction(const Information &action) {
         return builtJoinGameFeedback();
     } else if (feedback_type == InformationID::FEEDBACK_GAME_STATE) {
         return builtGameStateFeedback();
+    } else if (feedback_type == InformationID::FEEDBACK_GAME_STATE_COMPACT) {
+        return builtCompactGameStateFeedback();
     } else if (feedback_type == InformationID::FEEDBACK_GAME_SCORE) {
         return builtGameScoreFeedback();
+    } else if (feedback_type == InformationID::FEEDBACK_DATAGRAM_OFFER) {
+        return builtDatagramOfferFeedback();
+    } else if (feedback_type == InformationID::FEEDBACK_COMPRESSION) {
+        return builtCompressionFeedback();
+    } else if (feedback_type == InformationID::FEEDBACK_COMPRESSED) {
+        return builtCompressedFeedback();
+    } else if (feedback_type == InformationID::FEEDBACK_SERVER_FULL) {
+        return builtServerFullFeedback();
+    } else if (feedback_type == InformationID::FEEDBACK_GAME_LIST) {
+        return builtGameListFeedback();
     }
     return nullptr;
 }
@@ -2,16 +2,38 @@
 // Created by luan on 12/06/23.
 //
 #include "../include/receiver.h"
+#include "../include/config_game.h"
+#include "../../Common/include/Information/information_code.h"
+#include "../../Common/include/Information/feedback_server_datagramoffer.h"
+#include "../../Common/include/Information/feedback_server_full.h"
 
 Receiver::Receiver(Queue<std::shared_ptr<Information>> &feedback_received,
-                   GameSocket &socket) :
+                   GameSocket &socket, const std::string& hostname) :
                    feedback_received(feedback_received),
                    protocol(socket),
                    socket(socket),
+                   hostname(hostname),
+                   use_datagrams(GameConfig().use_datagrams),
+                   datagram_receiver(nullptr),
                    is_running(true),
                    keep_receiving(true) {
 }
 
+void Receiver::acceptDatagramOffer(const Information& offer) {
+    std::lock_guard<std::mutex> lock(datagram_mutex);
+    if (!use_datagrams || datagram_receiver || !keep_receiving) return;
+    const auto& datagram_offer = static_cast<const DatagramOfferFeedback&>(offer);
+    try {
+        datagram_receiver.reset(new DatagramReceiver(feedback_received, hostname,
+                                                     datagram_offer.port, datagram_offer.token));
+        datagram_receiver->start();
+    } catch (const std::exception& e) {
+        // sin UDP se sigue todo por TCP
+        std::cerr << "Receiver::acceptDatagramOffer. " << e.what() << std::endl;
+        datagram_receiver.reset();
+    }
+}
+
 void Receiver::run() {
     using std::cerr;
     using std::endl;
@@ -22,6 +44,20 @@ void Receiver::run() {
         if (feed == nullptr) {
             throw std::runtime_error("Receiver::run. Feedback received is null. Probably cause it is invalid.\n");
         }
+        if (feed->get_type() == FEEDBACK_DATAGRAM_OFFER) {
+            acceptDatagramOffer(*feed);
+            continue;
+        }
+        // la respuesta al pedido de compresion no le importa al lobby
+        if (feed->get_type() == FEEDBACK_COMPRESSION) continue;
+        if (feed->get_type() == FEEDBACK_SERVER_FULL &&
+            static_cast<const ServerFullFeedback&>(*feed).reason == FULL_CONNECTIONS) {
+            // el servidor cierra y el lobby queda esperando: se le cierra la cola
+            cerr << "The server is full, try again later." << endl;
+            feedback_received.close();
+            keep_receiving = false;
+            break;
+        }
         feedback_received.push(feed);
     }
     } catch (const ClosedSocket& err) {
@@ -40,6 +76,10 @@ void Receiver::run() {
 
 void Receiver::stop() {
     keep_receiving = false;
+    {
+        std::lock_guard<std::mutex> lock(datagram_mutex);
+        if (datagram_receiver) datagram_receiver->stop();
+    }
     socket._shutdown(SHUT_RDWR);
     socket._close();
     feedback_received.close();
@@ -47,4 +87,12 @@ void Receiver::stop() {
 
 bool Receiver::isDead() const {
     return !is_running;
-}
\ No newline at end of file
+}
+
+Receiver::~Receiver() {
+    std::lock_guard<std::mutex> lock(datagram_mutex);
+    if (datagram_receiver) {
+        datagram_receiver->stop();
+        datagram_receiver->join();
+    }
+}
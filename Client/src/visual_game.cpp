@@ -5,42 +5,70 @@
 #include "../include/visual_game.h"
 #include <iostream>
 
-GameVisual::GameVisual(std::uint16_t window_width, std::uint16_t window_height) :
+GameVisual::GameVisual(std::uint16_t window_width, std::uint16_t window_height, bool vsync) :
     sdl(SDL_INIT_VIDEO),
     window("Game", SDL_WINDOWPOS_UNDEFINED, SDL_WINDOWPOS_UNDEFINED,
            window_width, window_height, SDL_WINDOW_RESIZABLE),
-    renderer(window, -1, SDL_RENDERER_ACCELERATED),
+    renderer(window, -1, SDL_RENDERER_ACCELERATED | (vsync ? SDL_RENDERER_PRESENTVSYNC : 0)),
     drawer_manager(renderer),
     background_drawer(renderer, BACKGROUND_WAR1, window_width, window_height),
+    frame_overlay_drawer(renderer),
     window_x_position(0) {
 }
 
-void GameVisual::draw(unsigned int frameticks) {
+void GameVisual::drawBackground() {
     background_drawer.drawBehindLayers();
+}
+
+void GameVisual::drawActors(unsigned int frameticks) {
     drawer_manager.draw(frameticks);
 }
 
+void GameVisual::drawFrameOverlay(const FramePacer &frame_pacer) {
+    frame_overlay_drawer.draw(frame_pacer);
+}
+
 void GameVisual::updateInfo(const GameStateFeedback &feed) {
     std::uint8_t player_count = 0;
     std::int32_t players_pos_x_sum = 0;
 
+    // primero la camara con este snapshot, asi el recorte y las posiciones no
+    // quedan un snapshot atrasados
     for (auto & pair_id_state : feed.elements) {
-        std::uint16_t actor_id = pair_id_state.first;
         const ElementStateDTO& actor_state = pair_id_state.second;
-        drawer_manager.updateInfo(actor_id, actor_state, window_x_position, window.GetWidth(), window.GetHeight());
-
-        if (actor_id < 100 && actor_state.is_dead != 1) {
+        if (pair_id_state.first < 100 && actor_state.is_dead != 1) {
             player_count++;
             players_pos_x_sum += actor_state.position_x;
-
         }
     }
     if (player_count > 0) {
         window_x_position = (players_pos_x_sum / player_count) - window.GetWidth() / 2;
     }
+
+    removeLeftActors(feed);
+    drawer_manager.beginUpdate(window_x_position, window.GetWidth());
+    for (auto & pair_id_state : feed.elements) {
+        drawer_manager.updateInfo(pair_id_state.first, pair_id_state.second, window_x_position,
+                                  window.GetWidth(), window.GetHeight());
+    }
+    drawer_manager.endUpdate();
     background_drawer.updateInfo(window_x_position, window.GetWidth(), window.GetHeight());
 }
 
+void GameVisual::removeLeftActors(const GameStateFeedback &feed) {
+    for (std::uint16_t actor_id : feed.left_elements) {
+        drawer_manager.removeActor(actor_id);
+    }
+}
+
+std::int32_t GameVisual::getWindowX() const {
+    return window_x_position;
+}
+
+std::uint16_t GameVisual::getWindowWidth() const {
+    return window.GetWidth();
+}
+
 void GameVisual::clear() {
     renderer.Clear();
 }
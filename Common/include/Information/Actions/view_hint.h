@@ -0,0 +1,23 @@
+#ifndef ACTION_VIEWHINT_H
+#define ACTION_VIEWHINT_H
+
+#include "../information.h"
+
+// El cliente le avisa al server que porcion del mapa esta mirando.
+// window_x es el borde izquierdo de la ventana en coordenadas del mapa.
+class ViewHintAction : public Information {
+public:
+    const std::int32_t window_x;
+    const std::uint16_t window_width;
+
+    ViewHintAction(std::int32_t window_x, std::uint16_t window_width);
+
+    [[nodiscard]] std::vector<int8_t> serialize() const override;
+
+    ViewHintAction(const ViewHintAction&) = delete;
+    ViewHintAction& operator=(const ViewHintAction&) = delete;
+
+    ~ViewHintAction() override = default;
+};
+
+#endif  // ACTION_VIEWHINT_H
@@ -0,0 +1,23 @@
+#ifndef TP_REQUEST_COMPRESSION_H
+#define TP_REQUEST_COMPRESSION_H
+#include "../information.h"
+
+/* Antes de crear o unirse a una partida el cliente puede pedir que los
+mensajes grandes le lleguen comprimidos con el codec indicado */
+
+class CompressionRequest : public Information {
+
+public:
+    const std::uint8_t codec;
+
+    explicit CompressionRequest(std::uint8_t codec);
+
+    [[nodiscard]] std::vector<int8_t> serialize() const override;
+
+    CompressionRequest(const CompressionRequest&) = delete;
+    CompressionRequest& operator=(const CompressionRequest&) = delete;
+
+    ~CompressionRequest() override = default;
+};
+
+#endif //TP_REQUEST_COMPRESSION_H
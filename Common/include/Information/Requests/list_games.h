@@ -0,0 +1,24 @@
+#ifndef TP_REQUEST_LIST_GAMES_H
+#define TP_REQUEST_LIST_GAMES_H
+#include "../information.h"
+
+/* Pide las partidas abiertas. mode y difficulty usan los mismos codigos que
+CreateGameAction (REQUEST_SURVIVAL, REQUEST_EASY, ...); VOID es cualquiera */
+
+class ListGamesRequest : public Information {
+
+public:
+    const std::uint8_t mode;
+    const std::uint8_t difficulty;
+
+    ListGamesRequest(std::uint8_t mode, std::uint8_t difficulty);
+
+    [[nodiscard]] std::vector<int8_t> serialize() const override;
+
+    ListGamesRequest(const ListGamesRequest&) = delete;
+    ListGamesRequest& operator=(const ListGamesRequest&) = delete;
+
+    ~ListGamesRequest() override = default;
+};
+
+#endif //TP_REQUEST_LIST_GAMES_H
@@ -0,0 +1,25 @@
+#ifndef TP_REQUEST_QUICK_MATCH_H
+#define TP_REQUEST_QUICK_MATCH_H
+#include "../information.h"
+
+/* Pide entrar a cualquier partida de ese modo y dificultad (mismos codigos
+que CreateGameAction). El servidor responde FEEDBACK_JOIN_GAME si lo metio
+en una que ya existia o FEEDBACK_CREATE_GAME si armo una nueva */
+
+class QuickMatchRequest : public Information {
+
+public:
+    const std::uint8_t mode;
+    const std::uint8_t difficulty;
+
+    QuickMatchRequest(std::uint8_t mode, std::uint8_t difficulty);
+
+    [[nodiscard]] std::vector<int8_t> serialize() const override;
+
+    QuickMatchRequest(const QuickMatchRequest&) = delete;
+    QuickMatchRequest& operator=(const QuickMatchRequest&) = delete;
+
+    ~QuickMatchRequest() override = default;
+};
+
+#endif //TP_REQUEST_QUICK_MATCH_H
@@ -0,0 +1,42 @@
+#ifndef TP_COMPACT_ENCODING_H
+#define TP_COMPACT_ENCODING_H
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+/* Herramientas para los formatos compactos.
+Varint: 7 bits por byte, el bit alto indica que sigue otro byte (LEB128).
+ZigZag: los negativos chicos quedan como varints chicos (-1 -> 1, 1 -> 2). */
+
+class CompactWriter {
+    std::vector<std::int8_t>& result;
+
+public:
+    explicit CompactWriter(std::vector<std::int8_t>& result);
+
+    void putByte(std::uint8_t byte);
+    void putVarint(std::uint32_t number);
+    void putZigZag(std::int32_t number);
+
+    /* Cuantos bytes ocupa number como varint */
+    static std::size_t varintSize(std::uint32_t number);
+};
+
+/* Lee lo que escribio CompactWriter. Tira runtime_error si el buffer
+se termina o un varint es invalido. */
+class CompactReader {
+    const std::vector<std::int8_t>& data;
+    std::size_t position;
+
+public:
+    explicit CompactReader(const std::vector<std::int8_t>& data, std::size_t position = 0);
+
+    std::uint8_t getByte();
+    std::uint32_t getVarint();
+    std::int32_t getZigZag();
+
+    [[nodiscard]] std::size_t remaining() const;
+};
+
+#endif //TP_COMPACT_ENCODING_H
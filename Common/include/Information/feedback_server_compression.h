@@ -0,0 +1,28 @@
+#ifndef TP_FEEDBACK_SERVER_COMPRESSION_H
+#define TP_FEEDBACK_SERVER_COMPRESSION_H
+
+#include "../Information/information.h"
+
+/* Respuesta al REQUEST_COMPRESSION con el codec que usa el servidor
+(COMPRESSION_NONE si no comprime). Va sin comprimir; desde ahi los mensajes
+grandes pueden llegar como FEEDBACK_COMPRESSED:
+[id][largo comprimido 4 bytes][largo original 4 bytes][deflate]
+y adentro hay un mensaje comun, con su propio id. */
+
+class CompressionFeedback : public Information {
+public:
+    const std::uint8_t codec;
+
+    explicit CompressionFeedback(std::uint8_t codec);
+
+    [[nodiscard]] std::vector<std::int8_t> serialize() const override;
+
+    [[nodiscard]] std::uint8_t get_type(void) const override;
+
+    CompressionFeedback(const CompressionFeedback&) = delete;
+    CompressionFeedback& operator=(const CompressionFeedback&) = delete;
+
+    ~CompressionFeedback() override = default;
+};
+
+#endif //TP_FEEDBACK_SERVER_COMPRESSION_H
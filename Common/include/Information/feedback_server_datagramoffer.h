@@ -0,0 +1,28 @@
+#ifndef TP_FEEDBACK_SERVER_DATAGRAMOFFER_H
+#define TP_FEEDBACK_SERVER_DATAGRAMOFFER_H
+
+#include "../Information/information.h"
+
+/* El servidor ofrece mandar los snapshots por UDP, despues del join.
+Si el cliente acepta manda al puerto un datagrama con el token (4 bytes,
+big endian) y desde ahi los FEEDBACK_GAME_STATE llegan por UDP, cada uno
+precedido por un numero de secuencia de 4 bytes. */
+
+class DatagramOfferFeedback : public Information {
+public:
+    const std::uint16_t port;
+    const std::uint32_t token;
+
+    DatagramOfferFeedback(std::uint16_t port, std::uint32_t token);
+
+    [[nodiscard]] std::vector<std::int8_t> serialize() const override;
+
+    [[nodiscard]] std::uint8_t get_type(void) const override;
+
+    DatagramOfferFeedback(const DatagramOfferFeedback&) = delete;
+    DatagramOfferFeedback& operator=(const DatagramOfferFeedback&) = delete;
+
+    ~DatagramOfferFeedback() override = default;
+};
+
+#endif //TP_FEEDBACK_SERVER_DATAGRAMOFFER_H
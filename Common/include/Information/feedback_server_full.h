@@ -0,0 +1,26 @@
+#ifndef TP_FEEDBACK_SERVER_FULL_H
+#define TP_FEEDBACK_SERVER_FULL_H
+
+#include "../Information/information.h"
+
+/* El servidor esta al limite. Con FULL_CONNECTIONS es lo unico que se manda
+antes de cerrar; con FULL_GAMES reemplaza al FEEDBACK_CREATE_GAME y la
+conexion sigue abierta. */
+
+class ServerFullFeedback : public Information {
+public:
+    const std::uint8_t reason;
+
+    explicit ServerFullFeedback(std::uint8_t reason);
+
+    [[nodiscard]] std::vector<std::int8_t> serialize() const override;
+
+    [[nodiscard]] std::uint8_t get_type(void) const override;
+
+    ServerFullFeedback(const ServerFullFeedback&) = delete;
+    ServerFullFeedback& operator=(const ServerFullFeedback&) = delete;
+
+    ~ServerFullFeedback() override = default;
+};
+
+#endif //TP_FEEDBACK_SERVER_FULL_H
@@ -0,0 +1,26 @@
+#ifndef TP_FEEDBACK_SERVER_GAMELIST_H
+#define TP_FEEDBACK_SERVER_GAMELIST_H
+
+#include "../Information/information.h"
+#include "game_summary_dto.h"
+
+/* Respuesta al REQUEST_LIST_GAMES: partidas a las que todavia se puede unir.
+[id][cantidad 2 bytes] y por partida [codigo 4 bytes][modo][dificultad][jugadores][maximo] */
+
+class GameListFeedback : public Information {
+public:
+    const std::vector<GameSummaryDTO> games;
+
+    explicit GameListFeedback(std::vector<GameSummaryDTO>&& games);
+
+    [[nodiscard]] std::vector<std::int8_t> serialize() const override;
+
+    [[nodiscard]] std::uint8_t get_type(void) const override;
+
+    GameListFeedback(const GameListFeedback&) = delete;
+    GameListFeedback& operator=(const GameListFeedback&) = delete;
+
+    ~GameListFeedback() override = default;
+};
+
+#endif //TP_FEEDBACK_SERVER_GAMELIST_H
@@ -7,15 +7,49 @@
 
 #include "../Information/information.h"
 #include "state_dto_element.h"
+#include <memory>
+
+/* Formato compacto del estado (FEEDBACK_GAME_STATE_COMPACT):
+[id][version][varint largo del payload][payload]
+payload: [varint cantidad][zigzag x base] elementos... [varint cantidad] ids que salieron...
+elemento: [varint id][tag][flags][varint x - x base][zigzag y][campos segun el esquema]
+tag: bits 0-3 tipo, bits 4-5 esquema, bit 6 vida llena, bit 7 municion llena.
+flags: bits 0-4 accion, bits 5-6 direccion + 1, bit 7 is_dead.
+Las posiciones ya son enteros en unidades del juego (paso de cuantizacion 1),
+se mandan como varint asi que y (< 200) ocupa 1 o 2 bytes y x (relativo al
+menor x del snapshot) 2 dentro de un area de interes normal. */
+constexpr std::uint8_t GAME_STATE_COMPACT_VERSION = 1;
+
+// Que campos ademas de la posicion lleva cada elemento.
+enum CompactSchema : std::uint8_t {
+    SCHEMA_PLAIN,  // throwables: nada mas
+    SCHEMA_HEALTH,  // zombies: vida
+    SCHEMA_SOLDIER  // soldados: vida, municion y tiempo
+};
 
 class GameStateFeedback : public Information {
 public:
     const std::vector<std::pair<std::uint16_t, ElementStateDTO>> elements;
+    // Ids que salieron del area de interes del jugador, el cliente borra sus drawers.
+    const std::vector<std::uint16_t> left_elements;
 
     explicit GameStateFeedback(std::vector<std::pair<std::uint16_t,ElementStateDTO>>&& elements);
+    GameStateFeedback(std::vector<std::pair<std::uint16_t,ElementStateDTO>>&& elements,
+                      std::vector<std::uint16_t>&& left_elements);
 
     [[nodiscard]] std::vector<int8_t> serialize() const override;
 
+    /* Mismo estado en el formato compacto */
+    [[nodiscard]] std::vector<int8_t> serializeCompact() const;
+
+    void serializeInto(std::vector<int8_t>& result) const override;
+    void serializeCompactInto(std::vector<int8_t>& result) const;
+
+    /* Arma el estado a partir del payload compacto (sin id, version ni largo).
+    Tira runtime_error si la version no es conocida o el payload es invalido. */
+    static std::shared_ptr<GameStateFeedback> fromCompact(std::uint8_t version,
+                                                          const std::vector<int8_t>& payload);
+
     [[nodiscard]] std::uint8_t get_type(void) const override;
 
     GameStateFeedback(const GameStateFeedback&) = delete;
@@ -0,0 +1,15 @@
+#ifndef TP_GAME_SUMMARY_DTO_H
+#define TP_GAME_SUMMARY_DTO_H
+
+#include <cstdint>
+
+// Una partida abierta tal como se lista en el lobby.
+struct GameSummaryDTO {
+    std::uint32_t game_code;
+    std::uint8_t mode;  // GameMode
+    std::uint8_t difficulty;  // GameDifficulty
+    std::uint8_t players;
+    std::uint8_t max_players;
+};
+
+#endif // TP_GAME_SUMMARY_DTO_H
@@ -14,32 +14,25 @@ class Information {
 protected:
     Information() = default;
     // que serialize sea privado y como publico se tenga serialize 16 y 32
+    // Escribe el numero en big endian directo al final del vector, byte mas
+    // significativo primero, sin pasar por htonl ni un push_back por byte.
     template <typename T>
     void serializeNumber(std::vector<int8_t>& result, T number) const {
         using std::uint32_t;
-        using std::uint8_t;
         using std::size_t;
 
-        size_t number_type_size = sizeof(number);
-        T big_endian_number;
-
-        if (number_type_size == sizeof(uint32_t)) {
-            big_endian_number = htonl(number);
-        } else if (number_type_size == sizeof(uint16_t)) {
-            big_endian_number = htons(number);
-        } else {
+        constexpr size_t number_type_size = sizeof(T);
+        if (number_type_size != sizeof(uint32_t) && number_type_size != sizeof(uint16_t)) {
             throw std::runtime_error("Information::serializeNumber. Invalid "
                                      "Number type");
         }
 
+        size_t offset = result.size();
+        result.resize(offset + number_type_size);
+        auto value = static_cast<uint32_t>(number);
         for (size_t index = 0; index < number_type_size; index++) {
-            // The mask guarantee that the 8 less significant bits are extracted.
-            T mask = 0xFF;
-            size_t amount_bits_to_shift = index * 8;
-            uint32_t shifted_number = big_endian_number >> amount_bits_to_shift;
-            uint32_t filtered_number = shifted_number & mask;
-            auto byte = static_cast<int8_t>(filtered_number);
-            result.push_back(byte);
+            size_t amount_bits_to_shift = (number_type_size - 1 - index) * 8;
+            result[offset + index] = static_cast<int8_t>(value >> amount_bits_to_shift);
         }
     }
 
@@ -50,6 +43,10 @@ public:
     [[nodiscard]] virtual std::vector<int8_t> serialize() const
     = 0;
 
+    /* Agrega la serializacion al final de result. Sirve para reusar buffers:
+    por defecto copia lo de serialize(), los feedbacks grandes lo redefinen. */
+    virtual void serializeInto(std::vector<int8_t>& result) const;
+
     virtual std::uint8_t get_type(void) const;
 
     Information(Information&&) = default;
@@ -27,8 +27,28 @@ enum InformationID : std::uint8_t {
     FEEDBACK_JOIN_GAME,
     FEEDBACK_GAME_STATE,
     FEEDBACK_GAME_SCORE,
+    ACTION_VIEW_HINT,
+    FEEDBACK_DATAGRAM_OFFER,
+    FEEDBACK_GAME_STATE_COMPACT,
+    REQUEST_COMPRESSION,
+    FEEDBACK_COMPRESSION,
+    FEEDBACK_COMPRESSED,
+    FEEDBACK_SERVER_FULL,
+    REQUEST_LIST_GAMES,
+    FEEDBACK_GAME_LIST,
+    REQUEST_QUICK_MATCH,
     VOID
 };
+// Codecs que se pueden negociar con REQUEST_COMPRESSION.
+enum CompressionCodec : std::uint8_t {
+    COMPRESSION_NONE,
+    COMPRESSION_DEFLATE
+};
+// Por que el servidor no atiende el pedido (FEEDBACK_SERVER_FULL).
+enum ServerFullReason : std::uint8_t {
+    FULL_CONNECTIONS,  // se cierra la conexion
+    FULL_GAMES  // no se crean mas partidas, todavia se puede unir a una
+};
 enum JoinFeed : std::uint8_t {
     NOT_JOINED,
     JOINED
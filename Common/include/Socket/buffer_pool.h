@@ -0,0 +1,35 @@
+#ifndef BUFFER_POOL_H_
+#define BUFFER_POOL_H_
+
+#include <cstdint>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+/* Pool de buffers de salida. Los buffers se devuelven vacios pero conservan
+su capacidad, asi serializar un mensaje por tick no pide memoria nueva.
+No es thread safe: cada Sender tiene el suyo. */
+
+class BufferPool {
+    std::vector<std::unique_ptr<std::vector<std::int8_t>>> free_buffers;
+    std::size_t initial_capacity;
+
+public:
+    /* parámetros: capacidad inicial de cada buffer y cuantos se crean de entrada */
+    explicit BufferPool(std::size_t initial_capacity = 0, std::size_t preallocated = 0);
+
+    /* Cambia la capacidad de los buffers nuevos y agrega preallocated al pool */
+    void configure(std::size_t initial_capacity, std::size_t preallocated);
+
+    /* Un buffer vacio, del pool si hay o nuevo si no */
+    std::unique_ptr<std::vector<std::int8_t>> acquire();
+
+    void release(std::unique_ptr<std::vector<std::int8_t>> buffer);
+
+    [[nodiscard]] std::size_t available() const;
+
+    BufferPool(const BufferPool&) = delete;
+    BufferPool& operator=(const BufferPool&) = delete;
+};
+
+#endif  // BUFFER_POOL_H_
@@ -0,0 +1,52 @@
+#ifndef FRAME_COMPRESSION_H_
+#define FRAME_COMPRESSION_H_
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <zlib.h>
+
+/* Compresion de mensajes por conexion con deflate (zlib).
+Un solo stream dura toda la conexion y cada mensaje se cierra con un
+Z_SYNC_FLUSH, asi el siguiente puede referirse a lo que ya se mando (una
+ventana de 32 KiB): los snapshots de ticks seguidos se parecen mucho y
+comprimen mejor que de a uno.
+Los 4 bytes fijos del flush (00 00 ff ff) no se mandan, el que descomprime
+los vuelve a poner. Como el stream es uno solo, los mensajes comprimidos
+tienen que descomprimirse en el mismo orden en que se comprimieron. */
+
+class FrameDeflater {
+    z_stream stream;
+
+public:
+    /* level: 1 (rapido) a 9 (mas chico). Tira runtime_error si zlib falla */
+    explicit FrameDeflater(int level);
+
+    /* Comprime size bytes y agrega el resultado al final de result */
+    void compress(const std::int8_t *data, std::size_t size, std::vector<std::int8_t>& result);
+
+    FrameDeflater(const FrameDeflater&) = delete;
+    FrameDeflater& operator=(const FrameDeflater&) = delete;
+
+    ~FrameDeflater();
+};
+
+class FrameInflater {
+    z_stream stream;
+    std::vector<std::uint8_t> input;
+
+public:
+    FrameInflater();
+
+    /* Descomprime un mensaje que tiene que medir raw_size bytes y lo deja en
+    result (reemplaza lo que hubiera). Tira runtime_error si no coincide */
+    void decompress(const std::int8_t *data, std::size_t size, std::size_t raw_size,
+                    std::vector<std::int8_t>& result);
+
+    FrameInflater(const FrameInflater&) = delete;
+    FrameInflater& operator=(const FrameInflater&) = delete;
+
+    ~FrameInflater();
+};
+
+#endif  // FRAME_COMPRESSION_H_
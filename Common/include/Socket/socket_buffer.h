@@ -0,0 +1,30 @@
+#ifndef SOCKET_BUFFER_H_
+#define SOCKET_BUFFER_H_
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include "socket.h"
+
+/* Socket sobre un buffer en memoria. Sirve para leer con el mismo
+protocolo un mensaje que llego entero, por ejemplo dentro de un datagrama.
+Si se pide mas de lo que queda tira ClosedSocket. */
+
+class BufferSocket : public Socket {
+    std::vector<std::int8_t> buffer;
+    std::size_t read_position;
+
+public:
+    BufferSocket();
+
+    BufferSocket(const void *data, std::size_t amount);
+
+    virtual void sendData(const void *data, std::size_t amount) override;
+    virtual void recvData(void *data, std::size_t amount) override;
+
+    [[nodiscard]] std::size_t remaining() const;
+
+    ~BufferSocket() override = default;
+};
+
+#endif  // SOCKET_BUFFER_H_
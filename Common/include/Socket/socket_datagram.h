@@ -0,0 +1,59 @@
+#ifndef SOCKET_DATAGRAM_H_
+#define SOCKET_DATAGRAM_H_
+
+#include <cstdint>
+#include <cstddef>
+#include <random>
+#include <sys/socket.h>
+
+/* Socket UDP para los snapshots del juego. No es confiable ni ordenado:
+quien recibe descarta lo viejo por numero de secuencia.
+El servidor lo abre en un puerto efimero y se conecta a la direccion del
+primer datagrama valido que recibe; el cliente se conecta al servidor. */
+
+class DatagramSocket {
+    int fd;
+    bool closed;
+    struct sockaddr_storage last_peer;
+    socklen_t last_peer_len;
+    // perdida simulada para probar en loopback, 0 = no se pierde nada
+    double loss;
+    std::mt19937 loss_rng;
+
+public:
+    /* Socket pasivo, parámetros: puerto o servicio ("0" para uno efimero) */
+    explicit DatagramSocket(const char *servname);
+
+    /* Socket conectado al servidor, parámetros: host y puerto */
+    DatagramSocket(const char *hostname, const char *servname);
+
+    DatagramSocket(const DatagramSocket&) = delete;
+    DatagramSocket& operator=(const DatagramSocket&) = delete;
+
+    /* Puerto local, para ofrecerlo al cliente */
+    [[nodiscard]] std::uint16_t localPort() const;
+
+    /* Manda un datagrama entero. Si el otro lado no esta escuchando no falla */
+    void sendDatagram(const void *data, std::size_t amount);
+
+    /* Espera hasta timeout_ms (-1 bloquea, 0 no espera) un datagrama.
+    Devuelve cuantos bytes llegaron o 0 si no llego nada */
+    std::size_t recvDatagram(void *data, std::size_t max_amount, int timeout_ms);
+
+    /* Conecta el socket a quien mando el ultimo datagrama recibido */
+    void connectToLastPeer();
+
+    /* Probabilidad de descartar cada datagrama que se manda (para pruebas) */
+    void setLoss(double probability);
+
+    /* Si la secuencia es posterior a last, contemplando que da la vuelta */
+    static bool isNewer(std::uint32_t sequence, std::uint32_t last);
+
+    int _shutdown(int how) const;
+
+    int _close();
+
+    ~DatagramSocket();
+};
+
+#endif  // SOCKET_DATAGRAM_H_
@@ -3,7 +3,10 @@
 
 #include <cstdint>
 #include <stdexcept>
+#include <string>
+#include <sys/uio.h>
 #include "socket.h"
+#include "socket_options.h"
 
 struct ClosedSocket : public std::exception {
     explicit ClosedSocket() = default;
@@ -13,19 +16,44 @@ struct ClosedSocket : public std::exception {
     virtual ~ClosedSocket() noexcept override = default;
 };
 
+/* accept fallo pero el socket pasivo sigue abierto: se puede reintentar.
+out_of_resources: faltan fds o memoria, conviene esperar antes */
+struct AcceptFailed : public std::runtime_error {
+    const bool out_of_resources;
+    AcceptFailed(const std::string& reason, bool out_of_resources) :
+        std::runtime_error(reason), out_of_resources(out_of_resources) {}
+};
+
+// conexiones sin aceptar que encola el kernel si no se pide otra cantidad
+constexpr int DEFAULT_BACKLOG = 20;
+
 class GameSocket : public Socket {
     int fd;
     bool closed;
+    // envios con MSG_ZEROCOPY hechos y confirmados por el kernel
+    std::uint32_t zerocopy_sent;
+    std::uint32_t zerocopy_done;
+    // lo que applyOptions deja para despues
+    bool cork_flushes;
+    bool quick_ack_allowed;
+    bool quick_ack_active;
 
     explicit GameSocket(int sktfd);
 
+    void setOption(int level, int name, int value, const char *option_name);
+    void setTimeout(int name, int timeout_ms, const char *option_name);
+
     std::size_t sendSome(const void *data, std::size_t amount) const;
+    std::size_t sendSomeBuffers(struct iovec *buffers, std::size_t count, bool zerocopy);
     std::size_t recvSome(void *data, std::size_t amount) const;
 
 public:
     GameSocket(const char *hostname, const char *servname);
 
-    explicit GameSocket(const char *servname);
+    /* Socket pasivo. backlog: conexiones sin aceptar que encola el kernel.
+    reuse_port: SO_REUSEPORT, para que varios sockets escuchen en el mismo
+    puerto y el kernel reparta las conexiones entre ellos */
+    explicit GameSocket(const char *servname, int backlog = DEFAULT_BACKLOG, bool reuse_port = false);
 
     GameSocket(const GameSocket&) = delete;
     GameSocket& operator=(const GameSocket&) = delete;
@@ -36,8 +64,55 @@ public:
     virtual void sendData(const void *data, std::size_t amount) override;
     virtual void recvData(void *data, std::size_t amount) override;
 
+    /* Manda todos los buffers con un solo sendmsg (mas llamadas solo si el
+    kernel acepta menos, y en ese caso con cork si esta habilitado).
+    Modifica el arreglo al avanzar.
+    Con zerocopy los buffers no se pueden tocar hasta que reapZeroCopy lo
+    confirme. Devuelve si se uso zero copy. */
+    bool sendBuffers(struct iovec *buffers, std::size_t count, bool zerocopy = false);
+
+    /* Habilita MSG_ZEROCOPY (SO_ZEROCOPY). Devuelve false si no esta disponible */
+    bool enableZeroCopy();
+
+    /* Lee sin bloquear las confirmaciones de zero copy. Devuelve cuantos
+    envios zero copy ya terminaron (comparable con zeroCopySent) */
+    std::uint32_t reapZeroCopy();
+
+    [[nodiscard]] std::uint32_t zeroCopySent() const;
+
+    /* Aplica las opciones. Tira runtime_error si el kernel rechaza alguna */
+    void applyOptions(const SocketOptions& options);
+
+    /* En partida se responde con ACK inmediato si quick_ack esta habilitado */
+    void setInGame(bool in_game);
+
+    /* El kernel apaga el ACK inmediato solo: se vuelve a poner una vez por
+    mensaje recibido (no por cada recvData, que lee campo por campo) */
+    void rearmQuickAck();
+
+    /* Con cork habilitado, lo que se manda entre beginFlush y endFlush sale
+    en segmentos llenos y recien al final */
+    void beginFlush();
+    void endFlush();
+
+    /* Bytes que todavia no salieron del buffer de envio (0 si no se sabe) */
+    [[nodiscard]] std::size_t pendingOutput() const;
+
+    /* RTT suavizado que estima el kernel, en microsegundos (0 si no se sabe) */
+    [[nodiscard]] std::uint32_t roundTripMicros() const;
+
+    /* Tira ClosedSocket si se cerro el socket pasivo y AcceptFailed si fallo
+    solo esta conexion (se corto antes de aceptarla, señal, sin fds...) */
     [[nodiscard]] GameSocket acceptClient() const;
 
+    /* Espera hasta timeout_ms a que haya algo para leer (o para aceptar).
+    Devuelve false si se cumplio el tiempo */
+    [[nodiscard]] bool waitIncoming(int timeout_ms) const;
+
+    /* Tira sin bloquear lo que ya llego. Cerrar con datos sin leer manda un
+    RST que puede hacer perder al otro lado lo ultimo que se le mando */
+    void discardInput() const;
+
     int _shutdown(int how) const;
 
     int _close();
@@ -0,0 +1,28 @@
+#ifndef SOCKET_OPTIONS_H_
+#define SOCKET_OPTIONS_H_
+
+/* Opciones de un socket TCP de juego. Todo apagado o en 0 deja lo que
+trae el kernel. Se aplican con GameSocket::applyOptions. */
+
+struct SocketOptions {
+    // manda los paquetes chicos enseguida, sin esperar a juntar (Nagle)
+    bool no_delay = false;
+    // ACK inmediato en vez de demorado, solo en partida (setInGame)
+    bool quick_ack = false;
+    // junta en segmentos llenos lo que sale en varias escrituras
+    // (beginFlush / endFlush, o un sendBuffers que no entro en un sendmsg)
+    bool cork = false;
+    // tamaños de los buffers del kernel en bytes
+    int send_buffer = 0;
+    int recv_buffer = 0;
+    // detecta conexiones muertas: segundos sin trafico, entre pruebas y cuantas
+    bool keepalive = false;
+    int keepalive_idle = 0;
+    int keepalive_interval = 0;
+    int keepalive_count = 0;
+    // cuanto puede bloquear un send/recv antes de fallar
+    int send_timeout_ms = 0;
+    int recv_timeout_ms = 0;
+};
+
+#endif  // SOCKET_OPTIONS_H_
@@ -8,10 +8,12 @@ class Resolver {
     struct addrinfo* next;
 
 public:
+    // is_datagram: direcciones para UDP en vez de TCP.
     Resolver(
             const char* hostname,
             const char* servname,
-            bool is_passive);
+            bool is_passive,
+            bool is_datagram = false);
 
     Resolver(const Resolver&) = delete;
     Resolver& operator=(const Resolver&) = delete;
@@ -0,0 +1,22 @@
+#include "../../../include/Information/Actions/view_hint.h"
+#include "../../../include/Information/information_code.h"
+
+ViewHintAction::ViewHintAction(std::int32_t window_x, std::uint16_t window_width) :
+        window_x(window_x),
+        window_width(window_width) {
+}
+
+std::vector<std::int8_t> ViewHintAction::serialize() const {
+    using std::int8_t;
+    using std::vector;
+    using std::uint32_t;
+    using std::uint16_t;
+
+    vector<int8_t> result;
+    result.reserve(7);
+
+    result.push_back(static_cast<int8_t>(InformationID::ACTION_VIEW_HINT));
+    this->serializeNumber<uint32_t>(result, static_cast<uint32_t>(window_x));
+    this->serializeNumber<uint16_t>(result, window_width);
+    return result;
+}
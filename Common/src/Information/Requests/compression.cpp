@@ -0,0 +1,9 @@
+#include "../../../include/Information/Requests/compression.h"
+
+CompressionRequest::CompressionRequest(std::uint8_t codec) :
+    codec(codec) {
+}
+
+std::vector<int8_t> CompressionRequest::serialize() const {
+    return {REQUEST_COMPRESSION, static_cast<int8_t>(codec)};
+}
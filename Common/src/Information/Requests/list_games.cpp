@@ -0,0 +1,10 @@
+#include "../../../include/Information/Requests/list_games.h"
+
+ListGamesRequest::ListGamesRequest(std::uint8_t mode, std::uint8_t difficulty) :
+    mode(mode),
+    difficulty(difficulty) {
+}
+
+std::vector<int8_t> ListGamesRequest::serialize() const {
+    return {REQUEST_LIST_GAMES, static_cast<int8_t>(mode), static_cast<int8_t>(difficulty)};
+}
@@ -0,0 +1,10 @@
+#include "../../../include/Information/Requests/quick_match.h"
+
+QuickMatchRequest::QuickMatchRequest(std::uint8_t mode, std::uint8_t difficulty) :
+    mode(mode),
+    difficulty(difficulty) {
+}
+
+std::vector<int8_t> QuickMatchRequest::serialize() const {
+    return {REQUEST_QUICK_MATCH, static_cast<int8_t>(mode), static_cast<int8_t>(difficulty)};
+}
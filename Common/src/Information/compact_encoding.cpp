@@ -0,0 +1,65 @@
+#include <stdexcept>
+#include "../../include/Information/compact_encoding.h"
+
+// un uint32 entra en 5 bytes de 7 bits
+constexpr unsigned int MAX_VARINT_BYTES = 5;
+
+CompactWriter::CompactWriter(std::vector<std::int8_t> &result) : result(result) {
+}
+
+void CompactWriter::putByte(std::uint8_t byte) {
+    result.push_back(static_cast<std::int8_t>(byte));
+}
+
+void CompactWriter::putVarint(std::uint32_t number) {
+    while (number >= 0x80) {
+        putByte(static_cast<std::uint8_t>((number & 0x7F) | 0x80));
+        number >>= 7;
+    }
+    putByte(static_cast<std::uint8_t>(number));
+}
+
+void CompactWriter::putZigZag(std::int32_t number) {
+    auto bits = static_cast<std::uint32_t>(number);
+    putVarint((bits << 1) ^ (number < 0 ? 0xFFFFFFFFu : 0u));
+}
+
+std::size_t CompactWriter::varintSize(std::uint32_t number) {
+    std::size_t size = 1;
+    while (number >= 0x80) {
+        number >>= 7;
+        ++size;
+    }
+    return size;
+}
+
+CompactReader::CompactReader(const std::vector<std::int8_t> &data, std::size_t position) :
+    data(data),
+    position(position) {
+}
+
+std::uint8_t CompactReader::getByte() {
+    if (position >= data.size()) {
+        throw std::runtime_error("CompactReader::getByte. Buffer underrun.\n");
+    }
+    return static_cast<std::uint8_t>(data[position++]);
+}
+
+std::uint32_t CompactReader::getVarint() {
+    std::uint32_t number = 0;
+    for (unsigned int index = 0; index < MAX_VARINT_BYTES; ++index) {
+        std::uint8_t byte = getByte();
+        number |= static_cast<std::uint32_t>(byte & 0x7F) << (7 * index);
+        if ((byte & 0x80) == 0) return number;
+    }
+    throw std::runtime_error("CompactReader::getVarint. Varint too long.\n");
+}
+
+std::int32_t CompactReader::getZigZag() {
+    std::uint32_t bits = getVarint();
+    return static_cast<std::int32_t>((bits >> 1) ^ (~(bits & 1) + 1));
+}
+
+std::size_t CompactReader::remaining() const {
+    return data.size() - position;
+}
@@ -0,0 +1,15 @@
+#include "../../include/Information/feedback_server_compression.h"
+#include "../../include/Information/information_code.h"
+
+CompressionFeedback::CompressionFeedback(std::uint8_t codec) :
+    codec(codec) {
+}
+
+std::vector<std::int8_t> CompressionFeedback::serialize() const {
+    return {static_cast<std::int8_t>(InformationID::FEEDBACK_COMPRESSION),
+            static_cast<std::int8_t>(codec)};
+}
+
+std::uint8_t CompressionFeedback::get_type(void) const {
+    return FEEDBACK_COMPRESSION;
+}
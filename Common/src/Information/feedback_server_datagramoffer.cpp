@@ -0,0 +1,24 @@
+#include "../../include/Information/feedback_server_datagramoffer.h"
+#include "../../include/Information/information_code.h"
+
+DatagramOfferFeedback::DatagramOfferFeedback(std::uint16_t port, std::uint32_t token) :
+    port(port),
+    token(token) {
+}
+
+std::vector<std::int8_t> DatagramOfferFeedback::serialize() const {
+    using std::int8_t;
+    using std::vector;
+
+    vector<int8_t> result;
+    result.reserve(7);
+
+    result.push_back(static_cast<int8_t>(InformationID::FEEDBACK_DATAGRAM_OFFER));
+    serializeNumber(result, port);
+    serializeNumber(result, token);
+    return result;
+}
+
+std::uint8_t DatagramOfferFeedback::get_type(void) const {
+    return FEEDBACK_DATAGRAM_OFFER;
+}
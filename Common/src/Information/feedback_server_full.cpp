@@ -0,0 +1,15 @@
+#include "../../include/Information/feedback_server_full.h"
+#include "../../include/Information/information_code.h"
+
+ServerFullFeedback::ServerFullFeedback(std::uint8_t reason) :
+    reason(reason) {
+}
+
+std::vector<std::int8_t> ServerFullFeedback::serialize() const {
+    return {static_cast<std::int8_t>(InformationID::FEEDBACK_SERVER_FULL),
+            static_cast<std::int8_t>(reason)};
+}
+
+std::uint8_t ServerFullFeedback::get_type(void) const {
+    return FEEDBACK_SERVER_FULL;
+}
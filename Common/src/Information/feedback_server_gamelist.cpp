@@ -0,0 +1,30 @@
+#include "../../include/Information/feedback_server_gamelist.h"
+#include "../../include/Information/information_code.h"
+
+GameListFeedback::GameListFeedback(std::vector<GameSummaryDTO>&& games) :
+    games(std::move(games)) {
+}
+
+std::vector<std::int8_t> GameListFeedback::serialize() const {
+    using std::int8_t;
+    using std::uint16_t;
+    using std::vector;
+
+    vector<int8_t> result;
+    result.reserve(3 + games.size() * 8);
+
+    result.push_back(static_cast<int8_t>(InformationID::FEEDBACK_GAME_LIST));
+    serializeNumber(result, static_cast<uint16_t>(games.size()));
+    for (const GameSummaryDTO& game : games) {
+        serializeNumber(result, game.game_code);
+        result.push_back(static_cast<int8_t>(game.mode));
+        result.push_back(static_cast<int8_t>(game.difficulty));
+        result.push_back(static_cast<int8_t>(game.players));
+        result.push_back(static_cast<int8_t>(game.max_players));
+    }
+    return result;
+}
+
+std::uint8_t GameListFeedback::get_type(void) const {
+    return FEEDBACK_GAME_LIST;
+}
@@ -3,25 +3,56 @@
 //
 #include "../../include/Information/feedback_server_gamestate.h"
 #include "../../include/Information/information_code.h"
+#include "../../include/Information/compact_encoding.h"
+#include <algorithm>
+
+constexpr std::uint8_t TAG_TYPE_MASK = 0x0F;
+constexpr std::uint8_t TAG_SCHEMA_SHIFT = 4;
+constexpr std::uint8_t TAG_SCHEMA_MASK = 0x03;
+constexpr std::uint8_t TAG_FULL_HEALTH = 0x40;
+constexpr std::uint8_t TAG_FULL_AMMO = 0x80;
+constexpr std::uint8_t FLAGS_ACTION_MASK = 0x1F;
+constexpr std::uint8_t FLAGS_DIRECTION_SHIFT = 5;
+constexpr std::uint8_t FLAGS_DIRECTION_MASK = 0x03;
+constexpr std::uint8_t FLAGS_DEAD = 0x80;
+
+// El esquema sale de los datos: lo que esta en cero no se manda.
+static CompactSchema schemaOf(const ElementStateDTO& dto) {
+    if (dto.ammo != 0 || dto.actual_ammo != 0 || dto.time_left != 0) return SCHEMA_SOLDIER;
+    if (dto.health != 0 || dto.actual_health != 0) return SCHEMA_HEALTH;
+    return SCHEMA_PLAIN;
+}
 
 GameStateFeedback::GameStateFeedback(
         std::vector<std::pair<std::uint16_t, ElementStateDTO>>
         &&elements) :
-        elements(std::move(elements)) {
+        elements(std::move(elements)),
+        left_elements() {
+}
+
+GameStateFeedback::GameStateFeedback(
+        std::vector<std::pair<std::uint16_t, ElementStateDTO>> &&elements,
+        std::vector<std::uint16_t> &&left_elements) :
+        elements(std::move(elements)),
+        left_elements(std::move(left_elements)) {
 }
 
+constexpr std::size_t LEGACY_ELEMENT_SIZE = 23;
+// maximo que ocupa el largo del payload compacto (varint de 32 bits)
+constexpr std::size_t MAX_SIZE_BYTES = 5;
+
 std::vector<int8_t> GameStateFeedback::serialize() const {
+    std::vector<int8_t> result;
+    serializeInto(result);
+    return result;
+}
+
+void GameStateFeedback::serializeInto(std::vector<int8_t>& result) const {
     using std::int8_t;
     using std::uint16_t;
-    using std::vector;
 
-    vector<int8_t> result;
-    std::size_t byte_amount = elements.size() * (sizeof(ElementStateDTO) +
-            sizeof(uint16_t));
-    unsigned int vector_max_size = result.max_size();
-    if (byte_amount < vector_max_size) {
-        result.reserve(byte_amount);
-    }
+    result.reserve(result.size() + 5 + elements.size() * LEGACY_ELEMENT_SIZE +
+                   left_elements.size() * sizeof(uint16_t));
 
     // Push Feedback ID
     result.push_back(InformationID::FEEDBACK_GAME_STATE);
@@ -48,9 +79,145 @@ std::vector<int8_t> GameStateFeedback::serialize() const {
         result.push_back(static_cast<int8_t>(dto.is_dead));
     }
 
+    // Push amount of elements that left and their ids.
+    serializeNumber<uint16_t>(result, static_cast<uint16_t>(left_elements.size()));
+    for (uint16_t left_id : left_elements) {
+        serializeNumber<uint16_t>(result, left_id);
+    }
+}
+
+std::vector<int8_t> GameStateFeedback::serializeCompact() const {
+    std::vector<int8_t> result;
+    serializeCompactInto(result);
     return result;
 }
 
+void GameStateFeedback::serializeCompactInto(std::vector<int8_t>& result) const {
+    using std::uint8_t;
+
+    result.reserve(result.size() + 2 + MAX_SIZE_BYTES + elements.size() * 12 +
+                   left_elements.size() * 2 + 4);
+    CompactWriter writer(result);
+    writer.putByte(InformationID::FEEDBACK_GAME_STATE_COMPACT);
+    writer.putByte(GAME_STATE_COMPACT_VERSION);
+    // se deja lugar para el largo y se completa al final
+    std::size_t size_position = result.size();
+    result.resize(size_position + MAX_SIZE_BYTES);
+    std::size_t payload_start = result.size();
+
+    // x se manda relativo al menor x del snapshot: el area de interes es
+    // angosta asi que los desplazamientos entran en 2 bytes
+    std::int32_t base_x = 0;
+    if (!elements.empty()) {
+        base_x = std::min_element(elements.begin(), elements.end(), [](const auto& a, const auto& b) {
+            return a.second.position_x < b.second.position_x;
+        })->second.position_x;
+    }
+    writer.putVarint(elements.size());
+    writer.putZigZag(base_x);
+    for (const auto& element : elements) {
+        const ElementStateDTO& dto = element.second;
+        if (dto.type > TAG_TYPE_MASK || dto.action > FLAGS_ACTION_MASK ||
+            dto.direction < -1 || dto.direction > 1 || dto.is_dead > 1) {
+            throw std::runtime_error("GameStateFeedback::serializeCompact. "
+                                     "Element does not fit the compact format.\n");
+        }
+        CompactSchema schema = schemaOf(dto);
+        bool full_health = dto.actual_health == dto.health;
+        bool full_ammo = dto.actual_ammo == dto.ammo;
+
+        uint8_t tag = dto.type | (schema << TAG_SCHEMA_SHIFT);
+        if (schema != SCHEMA_PLAIN && full_health) tag |= TAG_FULL_HEALTH;
+        if (schema == SCHEMA_SOLDIER && full_ammo) tag |= TAG_FULL_AMMO;
+        uint8_t flags = dto.action | ((dto.direction + 1) << FLAGS_DIRECTION_SHIFT);
+        if (dto.is_dead) flags |= FLAGS_DEAD;
+
+        writer.putVarint(element.first);
+        writer.putByte(tag);
+        writer.putByte(flags);
+        writer.putVarint(static_cast<std::uint32_t>(dto.position_x) - static_cast<std::uint32_t>(base_x));
+        writer.putZigZag(dto.position_y);
+        if (schema == SCHEMA_PLAIN) continue;
+        writer.putVarint(dto.health);
+        if (!full_health) writer.putVarint(dto.actual_health);
+        if (schema == SCHEMA_HEALTH) continue;
+        writer.putVarint(dto.ammo);
+        if (!full_ammo) writer.putVarint(dto.actual_ammo);
+        writer.putByte(dto.time_left);
+    }
+    writer.putVarint(left_elements.size());
+    for (std::uint16_t left_id : left_elements) {
+        writer.putVarint(left_id);
+    }
+
+    std::vector<int8_t> size_bytes;
+    CompactWriter(size_bytes).putVarint(result.size() - payload_start);
+    std::copy(size_bytes.begin(), size_bytes.end(), result.begin() + size_position);
+    result.erase(result.begin() + size_position + size_bytes.size(),
+                 result.begin() + payload_start);
+}
+
+std::shared_ptr<GameStateFeedback> GameStateFeedback::fromCompact(std::uint8_t version,
+        const std::vector<int8_t>& payload) {
+    using std::uint8_t;
+    using std::uint16_t;
+    using std::uint32_t;
+    using std::vector;
+    using std::pair;
+
+    if (version != GAME_STATE_COMPACT_VERSION) {
+        throw std::runtime_error("GameStateFeedback::fromCompact. Unknown version.\n");
+    }
+    CompactReader reader(payload);
+
+    uint32_t elements_amount = reader.getVarint();
+    std::int32_t base_x = reader.getZigZag();
+    // cada elemento ocupa al menos 5 bytes, asi no se reserva de mas con basura
+    if (elements_amount > reader.remaining() / 5) {
+        throw std::runtime_error("GameStateFeedback::fromCompact. Invalid element amount.\n");
+    }
+    vector<pair<uint16_t, ElementStateDTO>> elements;
+    elements.reserve(elements_amount);
+    for (uint32_t counter = 0; counter < elements_amount; ++counter) {
+        auto id = static_cast<uint16_t>(reader.getVarint());
+        uint8_t tag = reader.getByte();
+        uint8_t flags = reader.getByte();
+        int position_x = static_cast<int>(static_cast<uint32_t>(base_x) + reader.getVarint());
+        int position_y = reader.getZigZag();
+
+        auto schema = static_cast<uint8_t>((tag >> TAG_SCHEMA_SHIFT) & TAG_SCHEMA_MASK);
+        uint16_t health = 0, actual_health = 0, ammo = 0, actual_ammo = 0;
+        uint8_t time_left = 0;
+        if (schema == SCHEMA_HEALTH || schema == SCHEMA_SOLDIER) {
+            health = static_cast<uint16_t>(reader.getVarint());
+            actual_health = (tag & TAG_FULL_HEALTH) ? health : static_cast<uint16_t>(reader.getVarint());
+        }
+        if (schema == SCHEMA_SOLDIER) {
+            ammo = static_cast<uint16_t>(reader.getVarint());
+            actual_ammo = (tag & TAG_FULL_AMMO) ? ammo : static_cast<uint16_t>(reader.getVarint());
+            time_left = reader.getByte();
+        }
+        auto type = static_cast<uint8_t>(tag & TAG_TYPE_MASK);
+        auto action = static_cast<uint8_t>(flags & FLAGS_ACTION_MASK);
+        auto direction = static_cast<std::int8_t>(((flags >> FLAGS_DIRECTION_SHIFT) & FLAGS_DIRECTION_MASK) - 1);
+        uint8_t is_dead = (flags & FLAGS_DEAD) ? 1 : 0;
+        elements.emplace_back(id, ElementStateDTO{type, action, direction, position_x, position_y,
+                                                  health, actual_health, ammo, actual_ammo,
+                                                  time_left, is_dead});
+    }
+
+    uint32_t left_amount = reader.getVarint();
+    if (left_amount > reader.remaining()) {
+        throw std::runtime_error("GameStateFeedback::fromCompact. Invalid left amount.\n");
+    }
+    vector<uint16_t> left_elements;
+    left_elements.reserve(left_amount);
+    for (uint32_t counter = 0; counter < left_amount; ++counter) {
+        left_elements.push_back(static_cast<uint16_t>(reader.getVarint()));
+    }
+    return std::make_shared<GameStateFeedback>(std::move(elements), std::move(left_elements));
+}
+
 std::uint8_t GameStateFeedback::get_type(void) const {
     return FEEDBACK_GAME_STATE;
 }
@@ -20,4 +20,9 @@ Information::deserializeFourBytesNumber(const std::vector<int8_t>&
 std::uint8_t Information::get_type(void) const {
     // le pongo asi para no tener que hacer la funcion en todos los que heredan y no necesito
     return VOID;
-}
\ No newline at end of file
+}
+
+void Information::serializeInto(std::vector<int8_t>& result) const {
+    std::vector<int8_t> serialized = serialize();
+    result.insert(result.end(), serialized.begin(), serialized.end());
+}
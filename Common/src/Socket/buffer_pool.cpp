@@ -0,0 +1,38 @@
+#include "../../include/Socket/buffer_pool.h"
+
+BufferPool::BufferPool(std::size_t initial_capacity, std::size_t preallocated) :
+    free_buffers(),
+    initial_capacity(0) {
+    configure(initial_capacity, preallocated);
+}
+
+void BufferPool::configure(std::size_t initial_capacity, std::size_t preallocated) {
+    this->initial_capacity = initial_capacity;
+    free_buffers.reserve(free_buffers.size() + preallocated);
+    for (std::size_t i = 0; i < preallocated; ++i) {
+        auto buffer = std::make_unique<std::vector<std::int8_t>>();
+        buffer->reserve(initial_capacity);
+        free_buffers.push_back(std::move(buffer));
+    }
+}
+
+std::unique_ptr<std::vector<std::int8_t>> BufferPool::acquire() {
+    if (free_buffers.empty()) {
+        auto buffer = std::make_unique<std::vector<std::int8_t>>();
+        buffer->reserve(initial_capacity);
+        return buffer;
+    }
+    std::unique_ptr<std::vector<std::int8_t>> buffer = std::move(free_buffers.back());
+    free_buffers.pop_back();
+    return buffer;
+}
+
+void BufferPool::release(std::unique_ptr<std::vector<std::int8_t>> buffer) {
+    if (!buffer) return;
+    buffer->clear();
+    free_buffers.push_back(std::move(buffer));
+}
+
+std::size_t BufferPool::available() const {
+    return free_buffers.size();
+}
@@ -0,0 +1,70 @@
+#include <stdexcept>
+
+#include "../../include/Socket/frame_compression.h"
+
+// final de un Z_SYNC_FLUSH, siempre igual
+static const std::uint8_t SYNC_TAIL[4] = {0x00, 0x00, 0xff, 0xff};
+// deflate crudo (sin cabecera zlib) con la ventana maxima
+constexpr int RAW_WINDOW_BITS = -15;
+constexpr int MEMORY_LEVEL = 8;
+
+FrameDeflater::FrameDeflater(int level) : stream() {
+    if (deflateInit2(&stream, level, Z_DEFLATED, RAW_WINDOW_BITS, MEMORY_LEVEL,
+                     Z_DEFAULT_STRATEGY) != Z_OK) {
+        throw std::runtime_error("FrameDeflater. deflateInit2 failed.\n");
+    }
+}
+
+void FrameDeflater::compress(const std::int8_t *data, std::size_t size,
+                             std::vector<std::int8_t>& result) {
+    std::size_t offset = result.size();
+    // alcanza casi siempre de una, si no se agranda y se sigue
+    std::size_t chunk = deflateBound(&stream, size) + 8;
+
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<std::int8_t*>(data));
+    stream.avail_in = size;
+    do {
+        result.resize(offset + chunk);
+        stream.next_out = reinterpret_cast<Bytef*>(result.data() + offset);
+        stream.avail_out = chunk;
+        if (deflate(&stream, Z_SYNC_FLUSH) == Z_STREAM_ERROR) {
+            throw std::runtime_error("FrameDeflater::compress. deflate failed.\n");
+        }
+        offset += chunk - stream.avail_out;
+    } while (stream.avail_out == 0);
+    result.resize(offset - sizeof(SYNC_TAIL));
+}
+
+FrameDeflater::~FrameDeflater() {
+    deflateEnd(&stream);
+}
+
+FrameInflater::FrameInflater() : stream(), input() {
+    if (inflateInit2(&stream, RAW_WINDOW_BITS) != Z_OK) {
+        throw std::runtime_error("FrameInflater. inflateInit2 failed.\n");
+    }
+}
+
+void FrameInflater::decompress(const std::int8_t *data, std::size_t size, std::size_t raw_size,
+                               std::vector<std::int8_t>& result) {
+    input.assign(reinterpret_cast<const std::uint8_t*>(data),
+                 reinterpret_cast<const std::uint8_t*>(data) + size);
+    input.insert(input.end(), SYNC_TAIL, SYNC_TAIL + sizeof(SYNC_TAIL));
+    // un byte de mas para notar si el mensaje es mas largo de lo anunciado
+    result.resize(raw_size + 1);
+
+    stream.next_in = input.data();
+    stream.avail_in = input.size();
+    stream.next_out = reinterpret_cast<Bytef*>(result.data());
+    stream.avail_out = result.size();
+    int code = inflate(&stream, Z_SYNC_FLUSH);
+    if ((code != Z_OK && code != Z_BUF_ERROR) || stream.avail_in != 0 ||
+        result.size() - stream.avail_out != raw_size) {
+        throw std::runtime_error("FrameInflater::decompress. Invalid compressed frame.\n");
+    }
+    result.resize(raw_size);
+}
+
+FrameInflater::~FrameInflater() {
+    inflateEnd(&stream);
+}
@@ -0,0 +1,29 @@
+#include <cstring>
+
+#include "../../include/Socket/socket_buffer.h"
+#include "../../include/Socket/socket_game.h"
+
+BufferSocket::BufferSocket() : buffer(), read_position(0) {
+}
+
+BufferSocket::BufferSocket(const void *data, std::size_t amount) :
+    buffer(static_cast<const std::int8_t*>(data), static_cast<const std::int8_t*>(data) + amount),
+    read_position(0) {
+}
+
+void BufferSocket::sendData(const void *data, std::size_t amount) {
+    buffer.insert(buffer.end(), static_cast<const std::int8_t*>(data),
+                  static_cast<const std::int8_t*>(data) + amount);
+}
+
+void BufferSocket::recvData(void *data, std::size_t amount) {
+    if (amount > remaining()) {
+        throw ClosedSocket();
+    }
+    std::memcpy(data, buffer.data() + read_position, amount);
+    read_position += amount;
+}
+
+std::size_t BufferSocket::remaining() const {
+    return buffer.size() - read_position;
+}
@@ -0,0 +1,154 @@
+#include <sys/socket.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+
+#include "../../include/Socket/socket_datagram.h"
+#include "../../include/Socket/socket_game.h"
+#include "../../include/resolver.h"
+
+DatagramSocket::DatagramSocket(const char *servname) :
+    fd(-1),
+    closed(true),
+    last_peer(),
+    last_peer_len(0),
+    loss(0),
+    loss_rng(std::random_device()()) {
+    Resolver resolver(nullptr, servname, true, true);
+
+    while (resolver.hasNext() && closed) {
+        struct addrinfo* addr = resolver.nextAddr();
+
+        int sktfd = socket(addr->ai_family, addr->ai_socktype,
+                           addr->ai_protocol);
+        if (sktfd == -1) {
+            continue;
+        }
+        if (bind(sktfd, addr->ai_addr, addr->ai_addrlen) == -1) {
+            close(sktfd);
+            continue;
+        }
+        fd = sktfd;
+        closed = false;
+    }
+    if (closed || fd == -1) {
+        std::stringstream error_msg;
+        error_msg << "Datagram socket construction failed.\nServname: "
+        << (servname ? servname : "null") << ".\nReason: " << strerror(errno)
+        << std::endl;
+        throw std::runtime_error(error_msg.str());
+    }
+}
+
+DatagramSocket::DatagramSocket(const char *hostname, const char *servname) :
+    fd(-1),
+    closed(true),
+    last_peer(),
+    last_peer_len(0),
+    loss(0),
+    loss_rng(std::random_device()()) {
+    Resolver resolver(hostname, servname, false, true);
+
+    while (resolver.hasNext() && closed) {
+        struct addrinfo* addr = resolver.nextAddr();
+
+        int sktfd = socket(addr->ai_family, addr->ai_socktype,
+                           addr->ai_protocol);
+        if (sktfd == -1) {
+            continue;
+        }
+        // en UDP connect solo fija el destino y filtra lo que llega de otros
+        if (connect(sktfd, addr->ai_addr, addr->ai_addrlen) == -1) {
+            close(sktfd);
+            continue;
+        }
+        fd = sktfd;
+        closed = false;
+    }
+    if (closed || fd == -1) {
+        throw std::runtime_error("Datagram socket construction for client failed.\n");
+    }
+}
+
+std::uint16_t DatagramSocket::localPort() const {
+    struct sockaddr_storage addr{};
+    socklen_t len = sizeof(addr);
+    if (getsockname(fd, reinterpret_cast<struct sockaddr*>(&addr), &len) == -1) {
+        throw std::runtime_error("DatagramSocket::localPort. getsockname failed.\n");
+    }
+    if (addr.ss_family == AF_INET6) {
+        return ntohs(reinterpret_cast<struct sockaddr_in6*>(&addr)->sin6_port);
+    }
+    return ntohs(reinterpret_cast<struct sockaddr_in*>(&addr)->sin_port);
+}
+
+void DatagramSocket::sendDatagram(const void *data, std::size_t amount) {
+    if (loss > 0 && std::uniform_real_distribution<double>(0, 1)(loss_rng) < loss) return;
+    ssize_t bytes_sent = send(fd, data, amount, MSG_NOSIGNAL);
+    if (bytes_sent == -1) {
+        // el otro lado todavia no abrio su puerto o se fue: UDP no garantiza nada
+        if (errno == ECONNREFUSED || errno == EAGAIN || errno == ENOBUFS) return;
+        if (fd == -1 || errno == EBADF) throw ClosedSocket();
+        std::stringstream error_msg;
+        error_msg << "Socket sendDatagram failed for fd: " << fd << ".\nReason: "
+                  << strerror(errno) << std::endl;
+        throw std::runtime_error(error_msg.str());
+    }
+}
+
+std::size_t DatagramSocket::recvDatagram(void *data, std::size_t max_amount, int timeout_ms) {
+    struct pollfd waiting{fd, POLLIN, 0};
+    int ready = poll(&waiting, 1, timeout_ms);
+    if (ready == 0) return 0;
+    if (ready == -1) {
+        if (errno == EINTR) return 0;
+        throw std::runtime_error("Socket recvDatagram failed on poll.\n");
+    }
+    last_peer_len = sizeof(last_peer);
+    ssize_t bytes_recv = recvfrom(fd, data, max_amount, 0,
+        reinterpret_cast<struct sockaddr*>(&last_peer), &last_peer_len);
+    if (bytes_recv == -1) {
+        if (errno == ECONNREFUSED || errno == EAGAIN || errno == EINTR) return 0;
+        if (errno == EBADF) throw ClosedSocket();
+        std::stringstream error_msg;
+        error_msg << "Socket recvDatagram failed for fd: " << fd << ".\nReason: "
+                  << strerror(errno) << std::endl;
+        throw std::runtime_error(error_msg.str());
+    }
+    return bytes_recv;
+}
+
+void DatagramSocket::connectToLastPeer() {
+    if (last_peer_len == 0 ||
+        connect(fd, reinterpret_cast<struct sockaddr*>(&last_peer), last_peer_len) == -1) {
+        throw std::runtime_error("DatagramSocket::connectToLastPeer. connect failed.\n");
+    }
+}
+
+void DatagramSocket::setLoss(double probability) {
+    loss = probability;
+}
+
+bool DatagramSocket::isNewer(std::uint32_t sequence, std::uint32_t last) {
+    return static_cast<std::int32_t>(sequence - last) > 0;
+}
+
+int DatagramSocket::_shutdown(int how) const {
+    return shutdown(fd, how);
+}
+
+int DatagramSocket::_close() {
+    closed = true;
+    return close(fd);
+}
+
+DatagramSocket::~DatagramSocket() {
+    if (!closed) {
+        close(fd);
+    }
+}
@@ -1,5 +1,13 @@
 #include <sys/socket.h>
 #include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <linux/errqueue.h>
+#include <sys/time.h>
+#include <sys/ioctl.h>
+#include <linux/sockios.h>
+#include <poll.h>
+#include <climits>
 #include <unistd.h>
 #include <stdexcept>
 #include <sstream>
@@ -8,13 +16,16 @@
 #include "../../include/Socket/socket_game.h"
 #include "../../include/resolver.h"
 
-constexpr int MAX_PENDING_CONNECTIONS = 20;
-
 GameSocket::GameSocket(const char *hostname, const char *servname) {
     Resolver resolver(hostname, servname, false);
 
     closed = true;
     fd = -1;
+    zerocopy_sent = 0;
+    zerocopy_done = 0;
+    cork_flushes = false;
+    quick_ack_allowed = false;
+    quick_ack_active = false;
 
     while (resolver.hasNext() && closed) {
         struct addrinfo* addr = resolver.nextAddr();
@@ -41,10 +52,15 @@ GameSocket::GameSocket(const char *hostname, const char *servname) {
     }
 }
 
-GameSocket::GameSocket(const char* servname) {
+GameSocket::GameSocket(const char* servname, int backlog, bool reuse_port) {
     Resolver resolver = Resolver(nullptr, servname, true);
     closed = true;
     fd = -1;
+    zerocopy_sent = 0;
+    zerocopy_done = 0;
+    cork_flushes = false;
+    quick_ack_allowed = false;
+    quick_ack_active = false;
 
     while (resolver.hasNext() && closed) {
         struct addrinfo* addr = resolver.nextAddr();
@@ -54,11 +70,19 @@ GameSocket::GameSocket(const char* servname) {
         if (sktfd == -1) {
             continue;
         }
+        // permite reabrir el puerto enseguida aunque queden conexiones en TIME_WAIT
+        int reuse = 1;
+        setsockopt(sktfd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+        if (reuse_port &&
+            setsockopt(sktfd, SOL_SOCKET, SO_REUSEPORT, &reuse, sizeof(reuse)) == -1) {
+            close(sktfd);
+            continue;
+        }
         if (bind(sktfd, addr->ai_addr, addr->ai_addrlen) == -1) {
             close(sktfd);
             continue;
         }
-        if (listen(sktfd, MAX_PENDING_CONNECTIONS) == -1) {
+        if (listen(sktfd, backlog) == -1) {
             close(sktfd);
             continue;
         }
@@ -78,6 +102,11 @@ GameSocket::GameSocket(const char* servname) {
 GameSocket::GameSocket(GameSocket && other) noexcept {
     this->fd = other.fd;
     this->closed = other.closed;
+    this->zerocopy_sent = other.zerocopy_sent;
+    this->zerocopy_done = other.zerocopy_done;
+    this->cork_flushes = other.cork_flushes;
+    this->quick_ack_allowed = other.quick_ack_allowed;
+    this->quick_ack_active = other.quick_ack_active;
 
     other.fd = -1;
     other.closed = true;
@@ -93,6 +122,11 @@ GameSocket& GameSocket::operator=(GameSocket&& other) noexcept {
     }
     this->fd = other.fd;
     this->closed = other.closed;
+    this->zerocopy_sent = other.zerocopy_sent;
+    this->zerocopy_done = other.zerocopy_done;
+    this->cork_flushes = other.cork_flushes;
+    this->quick_ack_allowed = other.quick_ack_allowed;
+    this->quick_ack_active = other.quick_ack_active;
 
     other.fd = -1;
     other.closed = true;
@@ -103,13 +137,19 @@ GameSocket& GameSocket::operator=(GameSocket&& other) noexcept {
 GameSocket::GameSocket(int sktfd) {
     fd = sktfd;
     closed = false;
+    zerocopy_sent = 0;
+    zerocopy_done = 0;
+    cork_flushes = false;
+    quick_ack_allowed = false;
+    quick_ack_active = false;
 }
 
 std::size_t GameSocket::sendSome(const void *data, std::size_t amount)
 const {
     ssize_t bytesSent = send(fd, data, amount, MSG_NOSIGNAL);
     if (bytesSent == -1) {
-        if (errno == EPIPE || fd == -1) {
+        // vencio SO_SNDTIMEO: el cliente no lee, se lo da por desconectado
+        if (errno == EPIPE || errno == EAGAIN || errno == EWOULDBLOCK || fd == -1) {
             throw ClosedSocket();
         } else {
             std::stringstream error_msg;
@@ -157,22 +197,203 @@ void GameSocket::recvData(void *data, std::size_t amount) {
     }
 }
 
+std::size_t GameSocket::sendSomeBuffers(struct iovec *buffers, std::size_t count, bool zerocopy) {
+    struct msghdr message{};
+    message.msg_iov = buffers;
+    message.msg_iovlen = count < IOV_MAX ? count : IOV_MAX;
+
+    ssize_t bytesSent = sendmsg(fd, &message, MSG_NOSIGNAL | (zerocopy ? MSG_ZEROCOPY : 0));
+    if (bytesSent == -1 && zerocopy && errno == ENOBUFS) {
+        // sin memoria para fijar las paginas: se manda copiando
+        return sendSomeBuffers(buffers, count, false);
+    }
+    if (bytesSent == -1) {
+        // igual que en sendSome, un envio que vencio cuenta como desconexion
+        if (errno == EPIPE || errno == EAGAIN || errno == EWOULDBLOCK || fd == -1) {
+            throw ClosedSocket();
+        }
+        std::stringstream error_msg;
+        error_msg << "Socket sendBuffers failed for fd: " << fd << ".\nReason: "<<
+                  strerror(errno) << std::endl;
+        throw std::runtime_error(error_msg.str());
+    }
+    if (zerocopy) ++zerocopy_sent;
+    return bytesSent;
+}
+
+bool GameSocket::sendBuffers(struct iovec *buffers, std::size_t count, bool zerocopy) {
+    std::uint32_t sent_before = zerocopy_sent;
+    // cork solo si hace falta mas de un sendmsg: con uno ya sale todo junto
+    bool first_write = true;
+    bool corked = false;
+    while (count > 0) {
+        // el kernel no tomo todo: el resto sale en segmentos llenos
+        if (!first_write && !corked && cork_flushes) {
+            setOption(IPPROTO_TCP, TCP_CORK, 1, "TCP_CORK");
+            corked = true;
+        }
+        first_write = false;
+        std::size_t bytesSent = sendSomeBuffers(buffers, count, zerocopy);
+        // avanzo sobre lo que ya salio
+        while (count > 0 && bytesSent >= buffers->iov_len) {
+            bytesSent -= buffers->iov_len;
+            ++buffers;
+            --count;
+        }
+        if (count > 0) {
+            buffers->iov_base = static_cast<std::int8_t*>(buffers->iov_base) + bytesSent;
+            buffers->iov_len -= bytesSent;
+        }
+    }
+    if (corked) setOption(IPPROTO_TCP, TCP_CORK, 0, "TCP_CORK");
+    return zerocopy_sent != sent_before;
+}
+
+bool GameSocket::enableZeroCopy() {
+#ifdef SO_ZEROCOPY
+    int enable = 1;
+    return setsockopt(fd, SOL_SOCKET, SO_ZEROCOPY, &enable, sizeof(enable)) == 0;
+#else
+    return false;
+#endif
+}
+
+std::uint32_t GameSocket::reapZeroCopy() {
+    while (zerocopy_done != zerocopy_sent) {
+        char control[128];
+        struct msghdr message{};
+        message.msg_control = control;
+        message.msg_controllen = sizeof(control);
+        if (recvmsg(fd, &message, MSG_ERRQUEUE | MSG_DONTWAIT) == -1) break;
+
+        for (struct cmsghdr *cmsg = CMSG_FIRSTHDR(&message); cmsg != nullptr;
+             cmsg = CMSG_NXTHDR(&message, cmsg)) {
+            bool is_recverr = (cmsg->cmsg_level == SOL_IP && cmsg->cmsg_type == IP_RECVERR) ||
+                              (cmsg->cmsg_level == SOL_IPV6 && cmsg->cmsg_type == IPV6_RECVERR);
+            if (!is_recverr) continue;
+            auto *error = reinterpret_cast<struct sock_extended_err*>(CMSG_DATA(cmsg));
+            if (error->ee_errno != 0 || error->ee_origin != SO_EE_ORIGIN_ZEROCOPY) continue;
+            // [ee_info, ee_data] es el rango de envios que el kernel ya solto
+            zerocopy_done = error->ee_data + 1;
+        }
+    }
+    return zerocopy_done;
+}
+
+std::uint32_t GameSocket::zeroCopySent() const {
+    return zerocopy_sent;
+}
+
+void GameSocket::setOption(int level, int name, int value, const char *option_name) {
+    if (setsockopt(fd, level, name, &value, sizeof(value)) == -1) {
+        std::stringstream error_msg;
+        error_msg << "Socket " << option_name << " failed for fd: " << fd <<
+                  ".\nReason: " << strerror(errno) << std::endl;
+        throw std::runtime_error(error_msg.str());
+    }
+}
+
+void GameSocket::setTimeout(int name, int timeout_ms, const char *option_name) {
+    struct timeval timeout{};
+    timeout.tv_sec = timeout_ms / 1000;
+    timeout.tv_usec = (timeout_ms % 1000) * 1000;
+    if (setsockopt(fd, SOL_SOCKET, name, &timeout, sizeof(timeout)) == -1) {
+        std::stringstream error_msg;
+        error_msg << "Socket " << option_name << " failed for fd: " << fd <<
+                  ".\nReason: " << strerror(errno) << std::endl;
+        throw std::runtime_error(error_msg.str());
+    }
+}
+
+void GameSocket::applyOptions(const SocketOptions &options) {
+    setOption(IPPROTO_TCP, TCP_NODELAY, options.no_delay, "TCP_NODELAY");
+    if (options.send_buffer > 0) setOption(SOL_SOCKET, SO_SNDBUF, options.send_buffer, "SO_SNDBUF");
+    if (options.recv_buffer > 0) setOption(SOL_SOCKET, SO_RCVBUF, options.recv_buffer, "SO_RCVBUF");
+    setOption(SOL_SOCKET, SO_KEEPALIVE, options.keepalive, "SO_KEEPALIVE");
+    if (options.keepalive) {
+        if (options.keepalive_idle > 0)
+            setOption(IPPROTO_TCP, TCP_KEEPIDLE, options.keepalive_idle, "TCP_KEEPIDLE");
+        if (options.keepalive_interval > 0)
+            setOption(IPPROTO_TCP, TCP_KEEPINTVL, options.keepalive_interval, "TCP_KEEPINTVL");
+        if (options.keepalive_count > 0)
+            setOption(IPPROTO_TCP, TCP_KEEPCNT, options.keepalive_count, "TCP_KEEPCNT");
+    }
+    setTimeout(SO_SNDTIMEO, options.send_timeout_ms, "SO_SNDTIMEO");
+    setTimeout(SO_RCVTIMEO, options.recv_timeout_ms, "SO_RCVTIMEO");
+    cork_flushes = options.cork;
+    quick_ack_allowed = options.quick_ack;
+}
+
+void GameSocket::setInGame(bool in_game) {
+    quick_ack_active = in_game && quick_ack_allowed;
+    if (quick_ack_active) setOption(IPPROTO_TCP, TCP_QUICKACK, 1, "TCP_QUICKACK");
+}
+
+void GameSocket::rearmQuickAck() {
+    if (!quick_ack_active) return;
+    int enable = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_QUICKACK, &enable, sizeof(enable));
+}
+
+void GameSocket::beginFlush() {
+    if (cork_flushes) setOption(IPPROTO_TCP, TCP_CORK, 1, "TCP_CORK");
+}
+
+void GameSocket::endFlush() {
+    // sacar el cork manda lo que quedo en un segmento incompleto
+    if (cork_flushes) setOption(IPPROTO_TCP, TCP_CORK, 0, "TCP_CORK");
+}
+
+std::size_t GameSocket::pendingOutput() const {
+    int pending = 0;
+    if (ioctl(fd, SIOCOUTQ, &pending) == -1 || pending < 0) return 0;
+    return pending;
+}
+
+std::uint32_t GameSocket::roundTripMicros() const {
+    struct tcp_info info{};
+    socklen_t length = sizeof(info);
+    if (getsockopt(fd, IPPROTO_TCP, TCP_INFO, &info, &length) == -1) return 0;
+    return info.tcpi_rtt;
+}
+
 GameSocket GameSocket::acceptClient() const {
     int peerfd = accept(fd, nullptr, nullptr);
     if (peerfd == -1) {
         if (errno == EBADF || errno == EINVAL) {
             throw ClosedSocket();
         } else {
+            bool out_of_resources = errno == EMFILE || errno == ENFILE ||
+                                    errno == ENOBUFS || errno == ENOMEM;
             std::stringstream error_msg;
             error_msg << "Socket acceptClient failed for fd: " << fd <<
             ".\nReason: "<< strerror(errno) << std::endl;
-            throw std::runtime_error(error_msg.str());
+            throw AcceptFailed(error_msg.str(), out_of_resources);
         }
     }
     return GameSocket(peerfd);
 }
 
+bool GameSocket::waitIncoming(int timeout_ms) const {
+    struct pollfd waiting{fd, POLLIN, 0};
+    int ready = poll(&waiting, 1, timeout_ms);
+    if (ready == -1) {
+        if (errno == EINTR) return false;
+        if (errno == EBADF) throw ClosedSocket();
+        throw std::runtime_error("Socket waitIncoming failed on poll.\n");
+    }
+    return ready > 0;
+}
+
+void GameSocket::discardInput() const {
+    std::int8_t discarded[512];
+    while (recv(fd, discarded, sizeof(discarded), MSG_DONTWAIT) > 0) {
+    }
+}
+
 int GameSocket::_shutdown(int how) const {
+    // ya cerrado: el numero de fd pudo haberse reusado
+    if (closed) return -1;
     return shutdown(fd, how);
 }
 
@@ -6,13 +6,14 @@
 
 Resolver::Resolver(const char *hostname,
                    const char *servname,
-                   bool is_passive) {
+                   bool is_passive,
+                   bool is_datagram) {
     struct addrinfo hints{};
     first = next = nullptr;
 
     memset(&hints, 0, sizeof(struct addrinfo));
     hints.ai_family = AF_INET;
-    hints.ai_socktype = SOCK_STREAM;
+    hints.ai_socktype = is_datagram ? SOCK_DGRAM : SOCK_STREAM;
     hints.ai_flags = is_passive ? AI_PASSIVE : 0;
 
     int ret = getaddrinfo(hostname, servname, &hints, &this->first);
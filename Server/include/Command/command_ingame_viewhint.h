@@ -0,0 +1,20 @@
+#ifndef TP_COMMAND_INGAME_VIEWHINT_H
+#define TP_COMMAND_INGAME_VIEWHINT_H
+
+#include "command_ingame.h"
+
+class ViewHintCommand : public InGameCommand {
+public:
+    std::int32_t window_x;
+    std::uint16_t window_width;
+    explicit ViewHintCommand(std::uint8_t player_id, std::int32_t window_x, std::uint16_t window_width);
+
+    virtual void execute(std::shared_ptr<Match> &match) const override;
+
+    ViewHintCommand(const ViewHintCommand&) = delete;
+    ViewHintCommand& operator=(const ViewHintCommand&) = delete;
+
+    ~ViewHintCommand() override = default;
+};
+
+#endif //TP_COMMAND_INGAME_VIEWHINT_H
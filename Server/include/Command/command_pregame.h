@@ -9,6 +9,7 @@
 #include "../../../libs/queue.h"
 #include "../../../Common/include/Information/information.h"
 #include "../game_manager.h"
+#include "../snapshot_rate.h"
 #include <cstdint>
 
 class PreGameCommand {
@@ -19,7 +20,8 @@ public:
     virtual bool execute(GameManager& game_manager,
                          Queue<std::shared_ptr<InGameCommand>> *&game_queue,
                          const std::shared_ptr<Queue<std::shared_ptr<Information>>> &player_queue,
-                         std::uint8_t* player_id) = 0;
+                         std::uint8_t* player_id,
+                         const std::shared_ptr<SnapshotRate> &rate = nullptr) = 0;
 
     PreGameCommand(PreGameCommand&&) = default;
     PreGameCommand& operator=(PreGameCommand&&) = default;
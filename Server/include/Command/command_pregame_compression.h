@@ -0,0 +1,24 @@
+#ifndef TP_COMMAND_PREGAME_COMPRESSION_H
+#define TP_COMMAND_PREGAME_COMPRESSION_H
+
+#include "command_pregame.h"
+
+/* Pedido de compresion del cliente. No une a ninguna partida: deja en la
+cola del jugador la respuesta y el Sender, al mandarla, decide el codec
+segun la configuracion y empieza a comprimir desde el mensaje siguiente. */
+
+class CompressionCommand : public PreGameCommand {
+    std::uint8_t codec;
+public:
+    explicit CompressionCommand(std::uint8_t codec);
+
+    virtual bool execute(GameManager& game_manager,
+                         Queue<std::shared_ptr<InGameCommand>> *&game_queue,
+                         const std::shared_ptr<Queue<std::shared_ptr<Information>>> &player_queue,
+                         std::uint8_t* player_id,
+                         const std::shared_ptr<SnapshotRate> &rate = nullptr) override;
+
+    ~CompressionCommand() = default;
+};
+
+#endif //TP_COMMAND_PREGAME_COMPRESSION_H
@@ -15,7 +15,8 @@ public:
     virtual bool execute(GameManager& game_manager,
                          Queue<std::shared_ptr<InGameCommand>> *&game_queue,
                          const std::shared_ptr<Queue<std::shared_ptr<Information>>> &player_queue,
-                         std::uint8_t* player_id) override;
+                         std::uint8_t* player_id,
+                         const std::shared_ptr<SnapshotRate> &rate = nullptr) override;
 
     ~JoinGameCommand() = default;
 };
@@ -0,0 +1,25 @@
+#ifndef TP_COMMAND_PREGAME_LISTGAMES_H
+#define TP_COMMAND_PREGAME_LISTGAMES_H
+
+#include "command_pregame.h"
+
+/* Pedido de las partidas abiertas. No une a ninguna partida: deja la lista
+en la cola del jugador y el cliente despues se une con el codigo que elija. */
+
+class ListGamesCommand : public PreGameCommand {
+    std::uint8_t mode;
+    std::uint8_t difficulty;
+public:
+    /* mode y difficulty como GameMode y GameDifficulty, o LOBBY_ANY */
+    ListGamesCommand(std::uint8_t mode, std::uint8_t difficulty);
+
+    virtual bool execute(GameManager& game_manager,
+                         Queue<std::shared_ptr<InGameCommand>> *&game_queue,
+                         const std::shared_ptr<Queue<std::shared_ptr<Information>>> &player_queue,
+                         std::uint8_t* player_id,
+                         const std::shared_ptr<SnapshotRate> &rate = nullptr) override;
+
+    ~ListGamesCommand() = default;
+};
+
+#endif //TP_COMMAND_PREGAME_LISTGAMES_H
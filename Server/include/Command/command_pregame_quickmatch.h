@@ -0,0 +1,24 @@
+#ifndef TP_COMMAND_PREGAME_QUICKMATCH_H
+#define TP_COMMAND_PREGAME_QUICKMATCH_H
+
+#include "command_pregame.h"
+
+/* Partida rapida: el jugador no elige codigo, el Matchmaker lo mete en una
+partida abierta de ese modo y dificultad o arma una con los que esperan. */
+
+class QuickMatchCommand : public PreGameCommand {
+    std::uint8_t gameMode;
+    std::uint8_t gameDifficulty;
+public:
+    QuickMatchCommand(std::uint8_t gameMode, std::uint8_t gameDifficulty);
+
+    virtual bool execute(GameManager& game_manager,
+                         Queue<std::shared_ptr<InGameCommand>> *&game_queue,
+                         const std::shared_ptr<Queue<std::shared_ptr<Information>>> &player_queue,
+                         std::uint8_t* player_id,
+                         const std::shared_ptr<SnapshotRate> &rate = nullptr) override;
+
+    ~QuickMatchCommand() = default;
+};
+
+#endif //TP_COMMAND_PREGAME_QUICKMATCH_H
@@ -5,6 +5,7 @@
 #include "../position.h"
 #include "../hitbox.h"
 #include "../radialhitbox.h"
+#include "../spawnplacer.h"
 #include "../../../../Common/include/Information/information_code.h"
 
 #include <map>
@@ -15,6 +16,7 @@
 class Zombie;
 class Throwable;
 class ThrowableFactory;
+class DamageBuffer;
 
 class Soldier {
 
@@ -32,6 +34,7 @@ public:
     uint8_t t_type;
     double revive_radius, revive_cooldown, reload_cooldown, throw_cooldown, throw_duration;
     double damage_recv = 0.0;
+    DamageBuffer* damage_buffer = nullptr; // si esta, el daño se acumula ahi hasta el fin del tick
     uint16_t kill_counter = 0;
     double actual_health = health;
     bool counted = false;
@@ -92,6 +95,8 @@ public:
     virtual void throwGrenade(uint8_t state);
     virtual void idle(uint8_t state);
     virtual void recvDamage(uint8_t state, double damage);
+    /* Aplica el daño ya acumulado del tick */
+    virtual void applyDamage(std::chrono::_V2::system_clock::time_point real_time, double damage);
     virtual void start_dying(uint8_t state);
     virtual void start_throw(uint8_t state);
     virtual void revive(uint8_t state);
@@ -148,9 +153,10 @@ public:
     /* SETTERS */
 
     void setPosition(Position&& new_pos);
-    void setRandomPosition(
-            const std::map<uint32_t, std::shared_ptr<Soldier>> &soldiers,
-            const std::map<uint32_t, std::shared_ptr<Zombie>> &zombies, double mass_center, double dim_x, double dim_y);
+    /* Ubica al soldado junto al equipo sin chocar a otro, parámetros: ubicador
+    de la partida, soldados, centro de masa y dimensiones del mapa */
+    void setRandomPosition(SpawnPlacer &placer,
+            const std::map<uint32_t, std::shared_ptr<Soldier>> &soldiers, double mass_center, double dim_x, double dim_y);
 };
 
 #endif  // SOLDIER_H_
@@ -6,10 +6,12 @@
 class Throwable;
 
 #include <memory>
+#include <mutex>
 #include "yaml-cpp/yaml.h"
 
 class ThrowableFactory {
     uint32_t& code_counter;
+    std::mutex mtx; // los venom pueden crear veneno desde varios hilos
 public:
     explicit ThrowableFactory(uint32_t& code_counter);
     std::shared_ptr<Throwable> create(uint32_t *throwable_id, 
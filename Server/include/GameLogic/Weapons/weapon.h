@@ -4,6 +4,7 @@
 #include "../../../../Common/include/Information/information_code.h"
 #include "../../../include/GameLogic/position.h"
 #include "../../../include/GameLogic/hitbox.h"
+#include "../../../include/GameLogic/hitscan.h"
 
 #include <utility>
 #include <cstdint>
@@ -19,6 +20,12 @@ class Zombie;
 class Weapon {
 protected:
     Weapon() = default;
+
+    // si el arma no esta en un match (tests) carga su propio HitScan en cada disparo
+    HitScan own_scan;
+    const HitScan* shared_scan = nullptr;
+    const HitScan& getHitScan(const std::map<uint32_t, std::shared_ptr<Zombie>>& zombies);
+
 public:
     uint32_t bullets_fired = 0;
     virtual ~Weapon() = default;
@@ -33,6 +40,9 @@ public:
 
     virtual void reload() = 0;
 
+    /* Usa el HitScan que el match carga una vez por tick, parámetros: puntero al HitScan */
+    void useHitScan(const HitScan* scan);
+
     virtual uint16_t getAmmo() = 0;
     virtual uint16_t getActualAmmo() = 0;
     virtual uint32_t getBulletsFired() = 0;
@@ -4,6 +4,7 @@
 #include "../position.h"
 #include "../hitbox.h"
 #include "../radialhitbox.h"
+#include "../spawnplacer.h"
 #include "../../../../Common/include/Information/information_code.h"
 
 #include <utility>
@@ -17,6 +18,8 @@
 class Throwable;
 class Soldier;
 class ThrowableFactory;
+class DamageBuffer;
+class Perception;
 
 class Zombie {
 public:
@@ -36,6 +39,7 @@ public:
     double damage_recv = 0.0;
     double damage;
     uint32_t attacker_id = 500; // num cualquiera
+    DamageBuffer* damage_buffer = nullptr; // si esta, el daño se acumula ahi hasta el fin del tick
     double actual_health = health;
     double actual_speed = speed;
 
@@ -58,6 +62,22 @@ public:
     bool stunned = false;
     bool counted = false;
 
+    /* percepcion cacheada, la llena Perception una vez por tick */
+    bool perceived = false;
+    bool sees_victim = false;
+    uint32_t seen_victim_id = 0;
+    bool hears_witch = false;
+    uint32_t heard_witch_id = 0;
+    double heard_witch_x = 0.0;
+    double heard_witch_y = 0.0;
+    bool near_team = true; // si no, la IA corre a menor frecuencia
+    bool flow_valid = false;
+    double flow_x = 0.0;
+    double flow_y = 0.0;
+    double separation_x = 0.0;
+    double separation_y = 0.0;
+    const Perception *perception = nullptr;
+
     virtual ~Zombie() {}
 
     explicit Zombie(
@@ -82,6 +102,10 @@ public:
     virtual void idle(uint8_t state);
     virtual void recvDamage(uint8_t state, double damage, uint32_t attacker);
     virtual void die(uint8_t state);
+
+    /* Aplica el daño ya acumulado del tick, devuelve true si lo mato */
+    virtual bool applyDamage(std::chrono::_V2::system_clock::time_point real_time,
+    double damage, uint32_t attacker);
     virtual void be_stunned(uint8_t state);
 
     /* SIMULADORES */
@@ -108,6 +132,17 @@ public:
     virtual bool CalculateNextPos_by_witch(double *next_x, double *next_y, 
     int8_t *direction, uint32_t witch_id, std::map<uint32_t, 
     std::shared_ptr<Zombie>>& zombies, double time);
+    /* Direccion de movimiento: la del flow field si la hay, sino hacia el objetivo,
+    mas la separacion. Deja (move_x, move_y) unitario o en cero */
+    void steer(double *move_x, double *move_y);
+    /* Posicion de la witch que escucha: la cacheada por la percepcion si la hay,
+    asi no lee la posicion de otro zombie mientras se simula en paralelo */
+    Position witchPosition(const std::shared_ptr<Zombie>& witch);
+    /* Si next_pos choca con otro zombie: contra las cajas de la percepcion si
+    la hay, sino contra las posiciones actuales. count_dying cuenta tambien a
+    los que estan muriendo o muertos */
+    bool collidesWithZombies(const Position& next_pos,
+        std::map<uint32_t, std::shared_ptr<Zombie>>& zombies, bool count_dying);
     virtual void simulateStunned(std::chrono::_V2::system_clock::time_point real_time);
 
     /* GETTERS */
@@ -130,9 +165,10 @@ public:
     /* SETTERS */
 
     void setPosition(Position&& new_pos);
-    void setRandomPosition(
-            const std::map<uint32_t, std::shared_ptr<Soldier>> &soldiers,
-            const std::map<uint32_t, std::shared_ptr<Zombie>> &zombies, double dim_x, double dim_y, double mass_center);
+    /* Ubica al zombie cerca del equipo sin chocar soldados, parámetros: ubicador
+    de la partida, soldados, dimensiones del mapa y centro de masa */
+    void setRandomPosition(SpawnPlacer &placer,
+            const std::map<uint32_t, std::shared_ptr<Soldier>> &soldiers, double dim_x, double dim_y, double mass_center);
 
 };
 
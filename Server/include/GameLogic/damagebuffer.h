@@ -0,0 +1,53 @@
+#ifndef DAMAGEBUFFER_H_
+#define DAMAGEBUFFER_H_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <vector>
+
+class Soldier;
+class Zombie;
+
+/* Buffer de daño del tick. Disparos, granadas, veneno y ataques cuerpo a cuerpo
+solo agregan eventos; el match los resuelve todos juntos al final del tick.
+El daño de un mismo tick se acumula (antes el ultimo golpe pisaba a los demas)
+y la baja se le adjudica al que mas daño hizo en ese tick, asi el resultado no
+depende del orden en que se simularon las entidades.
+Cada hilo escribe en su propio carril (lane) y se juntan al resolver. */
+
+class DamageBuffer {
+public:
+    struct Event {
+        uint32_t target;
+        uint32_t attacker;
+        double damage;
+    };
+
+    /* Cantidad de carriles, uno por hilo que puede agregar eventos */
+    void setLanes(size_t lanes);
+
+    /* Carril del hilo actual, el 0 es el del hilo del match */
+    static void setCurrentLane(size_t lane);
+
+    void toZombie(uint32_t zombie_id, double damage, uint32_t attacker_id);
+    void toSoldier(uint32_t soldier_id, double damage);
+
+    /* Aplica todo lo acumulado y vacia el buffer */
+    void resolve(std::chrono::_V2::system_clock::time_point real_time,
+        std::map<uint32_t, std::shared_ptr<Soldier>>& soldiers,
+        std::map<uint32_t, std::shared_ptr<Zombie>>& zombies);
+
+    bool empty(void) const;
+
+private:
+    std::vector<std::vector<Event>> zombie_lanes = std::vector<std::vector<Event>>(1);
+    std::vector<std::vector<Event>> soldier_lanes = std::vector<std::vector<Event>>(1);
+    // todos los carriles juntos para ordenar, se reusan entre ticks
+    std::vector<Event> zombie_events;
+    std::vector<Event> soldier_events;
+};
+
+#endif  // DAMAGEBUFFER_H_
@@ -0,0 +1,43 @@
+#ifndef FLOWFIELD_H_
+#define FLOWFIELD_H_
+
+#include <cstdint>
+#include <vector>
+
+/* Campo de distancias sobre la grilla del mapa (tira 2D, circular en x).
+Se siembra con las posiciones objetivo y se expande con un BFS multi-fuente,
+asi cada zombie solo mira las celdas vecinas para saber hacia donde ir. */
+
+class FlowField {
+public:
+    FlowField() {}
+
+    /* Dimensiona la grilla, parámetros: dimensiones del mapa y lado de la celda */
+    void resize(double dim_x, double dim_y, double cell_size);
+
+    void clear(void);
+    void addSeed(double x, double y);
+
+    /* Calcula las distancias (en celdas) desde las semillas */
+    void build(void);
+
+    bool empty(void) const;
+
+    /* Direccion unitaria hacia la semilla mas cercana desde (x, y).
+    Devuelve false si ya esta en la celda de una semilla o no hay semillas */
+    bool direction(double x, double y, double *dir_x, double *dir_y) const;
+
+private:
+    double cell_size = 1;
+    int32_t cells_x = 1;
+    int32_t cells_y = 1;
+    std::vector<uint16_t> distances;
+    std::vector<uint32_t> frontier;
+    bool seeded = false;
+
+    int32_t cellX(double x) const;
+    int32_t cellY(double y) const;
+    uint16_t distanceAt(int32_t cx, int32_t cy) const;
+};
+
+#endif  // FLOWFIELD_H_
@@ -0,0 +1,48 @@
+#ifndef HITSCAN_H_
+#define HITSCAN_H_
+
+#include <array>
+#include <cstdint>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <vector>
+
+class Zombie;
+
+/* Posiciones de los zombies vivos en arreglos contiguos (x e y por separado)
+para resolver los disparos en lote. El match la carga una vez por tick y la
+comparten todas las armas; la seleccion de candidatos no tiene saltos y la
+de los N mas cercanos usa un buffer fijo, sin reservar memoria por disparo. */
+
+class HitScan {
+public:
+    static constexpr size_t MAX_HITS = 32;
+
+    struct Hit {
+        double distance;
+        uint32_t id;
+    };
+
+    using Hits = std::array<Hit, MAX_HITS>;
+
+    /* Copia las posiciones de los zombies que no estan muriendo */
+    void load(const std::map<uint32_t, std::shared_ptr<Zombie>>& zombies);
+
+    /* Busca los zombies dentro del rectangulo del disparo y deja en hits los
+    max_hits mas cercanos a from_x, ordenados por distancia.
+    Devuelve cuantos quedaron */
+    size_t scan(double x_min, double x_max, double y_min, double y_max,
+        double from_x, size_t max_hits, Hits& hits) const;
+
+    size_t size(void) const;
+
+private:
+    std::vector<double> xs;
+    std::vector<double> ys;
+    std::vector<uint32_t> ids;
+    // indices que pasan el filtro, se reusa entre disparos
+    mutable std::vector<uint32_t> candidates;
+};
+
+#endif  // HITSCAN_H_
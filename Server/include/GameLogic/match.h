@@ -10,6 +10,11 @@
 #include "Throwables/poison.h"
 #include "Throwables/grenade_t.h"
 #include "position.h"
+#include "perception.h"
+#include "hitscan.h"
+#include "damagebuffer.h"
+#include "workerpool.h"
+#include "spawnplacer.h"
 #include "match_configurator.h"
 #include "../../../Common/include/Information/information_code.h"
 #include "../../../Common/include/Information/state_dto_element.h"
@@ -24,6 +29,7 @@
 #include <iomanip>
 #include <algorithm>
 #include <map>
+#include <set>
 #include <vector>
 #include <memory>
 #include <chrono>
@@ -54,6 +60,28 @@ public:
     uint8_t dead_soldiers_counter = 0;
     uint16_t dead_zombies_counter = 0;
     std::mutex mtx; // para la carga de scores en el archivo
+    // Ventana que ve cada jugador: (borde izquierdo, ancho). La manda el cliente.
+    std::map<uint32_t, std::pair<int32_t, uint16_t>> view_hints;
+    // Ids que se le mandaron a cada jugador en el ultimo snapshot.
+    std::map<uint32_t, std::set<uint16_t>> interest_sets;
+    int32_t interest_margin = 0;
+    int32_t view_hint_margin = 0;
+    // Objetivos de los zombies, se recalcula al principio de cada simulateStep.
+    Perception perception;
+    // Zombies vivos en arreglos contiguos, se carga antes de simular a los soldados.
+    HitScan hit_scan;
+    // Daño del tick, se resuelve despues de simular a todos.
+    DamageBuffer damage_buffer;
+    // Zombies a simular en este tick y pool para repartirlos entre hilos.
+    std::vector<Zombie*> active_zombies;
+    std::unique_ptr<WorkerPool> zombie_pool;
+    // Veneno que tiran los venom desde cada carril, se junta al final de la fase.
+    std::vector<std::map<uint32_t, std::shared_ptr<Throwable>>> pending_throwables;
+    size_t zombie_workers = 0;
+    size_t parallel_min_zombies = 0;
+    size_t zombies_per_chunk = 1;
+    // Ubica a los que entran a la partida, con un generador por partida.
+    SpawnPlacer spawner;
 
     /* Constructor de Match, parámetros: dimensiones del mapa */
     explicit Match(double x_dimension, double y_dimension, uint32_t code);
@@ -103,15 +131,46 @@ public:
     std::map<uint32_t, std::shared_ptr<Soldier>>& getSoldiers(void);
 
     virtual void simulateStep(std::chrono::_V2::system_clock::time_point real_time) = 0;
+
+    /* Fase de zombies del tick: percepcion (solo lectura) y despues cada zombie
+    por su cuenta, en paralelo si hay suficientes. El daño queda en damage_buffer */
+    void simulateZombies(std::chrono::_V2::system_clock::time_point real_time);
+
+    /* Configura la simulacion paralela, parámetros: hilos extra, minimo de zombies
+    para usarlos y tamaño de las tandas */
+    void setParallelism(size_t workers, size_t min_zombies, size_t chunk);
     
     std::vector<std::pair<uint16_t, ElementStateDTO >> getElementStates();
 
     GameStateFeedback getMatchState(void);
 
+    /* Guarda la ventana visible del jugador, parámetros: id del soldado, borde izquierdo y ancho */
+    void setViewHint(uint32_t soldier_id, int32_t window_x, uint16_t window_width);
+
+    bool hasViewHint(uint32_t soldier_id);
+
+    /* Estados dentro del area de interes del jugador: su ventana si la mandó,
+    sino el centro de masa del equipo +- interest_margin. Los soldados van siempre */
+    std::vector<std::pair<uint16_t, ElementStateDTO >> getElementStates(uint32_t soldier_id);
+
+    /* Registra lo que se le manda al jugador y devuelve los ids que salieron de su area */
+    std::vector<uint16_t> updateInterest(uint32_t soldier_id,
+        const std::vector<std::pair<uint16_t, ElementStateDTO >>& element_states);
+
+    /* Si el snapshot no se pudo mandar, los ids que salieron se vuelven a
+    avisar en el siguiente */
+    void restoreInterest(uint32_t soldier_id, const std::vector<uint16_t>& left);
+
+    /* Olvida la ventana y el area de interes del jugador que se fue */
+    void forgetPlayer(uint32_t soldier_id);
+
     std::vector<std::pair<uint16_t, ScoreDTO >> getScores();
     GameScoreFeedback getMatchScores(void);
 
     void setZombie(uint32_t zombie_id, uint8_t zombie_type);
+
+    /* Hace que todos los soldados y zombies manden su daño al buffer del tick */
+    void attachDamageBuffer(void);
     void setThrowable(std::shared_ptr<Throwable> &&throwable);
 
     bool is_over(void);
@@ -120,6 +179,11 @@ public:
 
     Match(const Match&) = delete;
     Match& operator=(const Match&) = delete;
+
+private:
+    /* Zombies y throwables a distancia en x <= half_width de center_x, dando la
+    vuelta al mapa. Los soldados van siempre */
+    std::vector<std::pair<uint16_t, ElementStateDTO >> collectElementStates(double center_x, double half_width);
 };
 
 #endif  // MATCH_H_
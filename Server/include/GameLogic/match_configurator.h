@@ -7,6 +7,7 @@
 #include <memory>
 #include <string>
 #include "Zombies/zombiefactory.h"
+#include "spawnplacer.h"
 
 #include "../../../Common/include/Information/information_code.h"
 #define SOLDIERS_MAX 100
@@ -27,11 +28,8 @@ public:
     void configurate(uint8_t mode, uint8_t difficulty,
     std::map<uint32_t, std::shared_ptr<Zombie>> &zombies,
     std::map<uint32_t, std::shared_ptr<Soldier>> &soldiers,
-    double dim_x, double dim_y, uint32_t *code_counter, uint16_t *zombie_counter, double mass_center);
-
-    void add_zombies(int amount, std::map<uint32_t, std::shared_ptr<Zombie>> &zombies,
-    std::map<uint32_t, std::shared_ptr<Soldier>> &soldiers,
-    double dim_x, double dim_y, uint32_t *code_counter, uint16_t *zombie_counter, double mass_center);
+    double dim_x, double dim_y, uint32_t *code_counter, uint16_t *zombie_counter, double mass_center,
+    SpawnPlacer &placer);
 
 };
 
@@ -0,0 +1,105 @@
+#ifndef PERCEPTION_H_
+#define PERCEPTION_H_
+
+#include "flowfield.h"
+#include "position.h"
+
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <memory>
+#include <vector>
+
+class Soldier;
+class Zombie;
+
+/* Pasada de percepcion compartida por tick: calcula de una vez, para todos
+los zombies, el soldado vivo mas cercano dentro de su vista y la witch gritando
+mas cercana dentro de su rango de escucha. Los zombies leen el resultado
+cacheado en vez de recorrer todos los soldados y zombies cada uno.
+Tambien decide el nivel de detalle de la IA: los zombies lejos del equipo
+se mueven de a tandas (round robin) cada far_slices ticks, pero todos ven
+sus objetivos actualizados en cada tick.
+Para moverse, cada zombie toma la direccion de un flow field (hacia los
+soldados o hacia las witches gritando) mas una separacion de sus vecinos.
+La separacion solo orienta: el choque contra otros zombies se sigue chequeando
+con las cajas que quedan guardadas al principio del tick. */
+
+class Perception {
+public:
+    struct Target {
+        double x;
+        double y;
+        uint32_t id;
+    };
+
+    /* Configura la IA por nivel de detalle, parámetros: distancia en x a partir
+    de la cual un zombie es lejano (0 desactiva) y en cuantas tandas se reparten */
+    void setLevelOfDetail(double near_distance, uint32_t far_slices);
+
+    /* Dimensiona los flow fields, parámetros: dimensiones del mapa y lado de la celda */
+    void setFlowField(double dim_x, double dim_y, double cell_size);
+
+    /* Configura la separacion entre zombies, parámetros: radio y peso sobre la direccion */
+    void setSeparation(double radius, double weight);
+
+    /* Recalcula los objetivos de todos los zombies, se llama una vez por tick
+    antes de simularlos */
+    void update(const std::map<uint32_t, std::shared_ptr<Soldier>>& soldiers,
+        const std::map<uint32_t, std::shared_ptr<Zombie>>& zombies);
+
+    /* Si el zombie se simula este tick: los cercanos siempre, los lejanos
+    solo en su tanda. Los que mueren o reciben daño no se postergan */
+    bool shouldSimulate(const Zombie& zombie) const;
+
+    /* Busca en targets (ordenado por x) el mas cercano a (x, y) con distancia
+    <= range, sin contar exclude_id. Compara distancias al cuadrado.
+    Si se pasa period el eje x es circular y tambien busca del otro lado del borde */
+    static bool nearest(const std::vector<Target>& targets, double x, double y,
+        double range, uint32_t exclude_id, Target *found,
+        double period = std::numeric_limits<double>::infinity());
+
+    /* Si next_pos choca con algun otro zombie segun las cajas del principio del
+    tick, parámetros: id del que se mueve, su proxima posicion y si cuentan los
+    que estan muriendo. No lee posiciones vivas, se puede usar en paralelo */
+    bool blocked(uint32_t zombie_id, const Position& next_pos, bool count_dying) const;
+
+private:
+    double near_distance = 0;
+    uint32_t far_slices = 1;
+    uint32_t tick = 0;
+    double period = std::numeric_limits<double>::infinity();
+    double separation_radius = 0;
+    double separation_weight = 0;
+    FlowField soldier_flow;
+    FlowField scream_flow;
+    // Se reusan entre ticks para no reservar memoria cada vez.
+    std::vector<Target> live_soldiers;
+    std::vector<Target> screaming_witches;
+    std::vector<Target> live_zombies;
+
+    struct Obstacle {
+        Aabb box;
+        uint32_t id;
+        bool dying;
+    };
+    // todos los zombies ordenados por x (dying incluye a los muertos), con la mitad de ancho mas grande
+    std::vector<Obstacle> obstacles;
+    double max_half_width = 0;
+
+    // Recorre targets desde x hacia los dos lados mientras dx^2 no supere a best.
+    static bool sweep(const std::vector<Target>& targets, double x, double y,
+        uint32_t exclude_id, double *best, Target *found);
+
+    // Busca choques entre los obstaculos con x en [x - reach, x + reach].
+    bool blockedNear(uint32_t zombie_id, const Position& next_pos, double x,
+        double reach, bool count_dying) const;
+
+    // Distancia en x al soldado vivo mas cercano, dando la vuelta al mapa.
+    double distanceToTeam(double x) const;
+
+    // Suma de empujes de los zombies vivos a menos de separation_radius.
+    void separation(const Zombie& zombie, double *sep_x, double *sep_y) const;
+};
+
+#endif  // PERCEPTION_H_
@@ -8,6 +8,15 @@
 #include <map>
 #include <memory>
 #include <tuple>
+#include <cstddef>
+
+/* Caja compacta para chequear colisiones en lote: centro y mitades */
+struct Aabb {
+    double x;
+    double y;
+    double half_width;
+    double half_height;
+};
 
 class Position {
 public:
@@ -17,6 +26,10 @@ public:
     double height;
     double dim_x;
     double dim_y;
+    // cacheados para no recalcular en cada colision
+    double half_width;
+    double half_height;
+    double period; // el mapa es circular en x con este periodo (infinito si no hay mapa)
 
     ~Position() = default;
 
@@ -24,6 +37,12 @@ public:
 
     [[nodiscard]] bool collides(const Position &other) const;
 
+    /* Colision contra count cajas, parámetros: cajas y mascara de salida (1 si choca).
+    Devuelve cuantas chocan */
+    size_t collides(const Aabb *others, size_t count, uint8_t *hits) const;
+
+    [[nodiscard]] Aabb getAabb() const;
+
     [[nodiscard]] double getXPos() const;
     [[nodiscard]] double getYPos() const;
     [[nodiscard]] double getWidth() const;
@@ -0,0 +1,62 @@
+#ifndef SPAWNPLACER_H_
+#define SPAWNPLACER_H_
+
+#include "position.h"
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <random>
+#include <vector>
+
+class Soldier;
+
+/* Ubica entidades nuevas sin sortear hasta dejar de chocar.
+El area de spawn (centro +- range, todo el alto del mapa) se parte en celdas
+del tamaño de la entidad; las que tocan a un soldado se marcan ocupadas y se
+sortea entre las libres sin repetir (Fisher-Yates parcial), asi cada ubicacion
+es O(1) y siempre termina. Cuando se usan todas las libres se vuelve a empezar:
+los zombies pueden encimarse entre ellos, como antes.
+El generador es uno por partida, con semilla fija si se configura. */
+
+class SpawnPlacer {
+public:
+    /* Semilla del generador, 0 toma una de std::random_device */
+    explicit SpawnPlacer(uint32_t seed = 0);
+
+    void seed(uint32_t seed);
+
+    /* Descarta la grilla, la proxima ubicacion la arma de nuevo con los soldados
+    actuales. Se llama al empezar cada tanda (oleada, join, etc) */
+    void reset(void);
+
+    /* Devuelve una posicion libre de soldados, parámetros: soldados, centro y
+    rango en x del area, tamaño de la entidad y dimensiones del mapa.
+    Si cambia el area o el tamaño respecto de la llamada anterior rearma la grilla */
+    Position place(const std::map<uint32_t, std::shared_ptr<Soldier>> &soldiers,
+        double center, double range, double width, double height, double dim_x, double dim_y);
+
+    /* Celdas libres de la grilla actual */
+    size_t freeSlots(void) const;
+
+private:
+    std::mt19937 rng;
+    bool valid = false;
+    double center = 0;
+    double range = 0;
+    double width = 0;
+    double height = 0;
+    double dim_x = 0;
+    double dim_y = 0;
+    double cell_width = 1;
+    double cell_height = 1;
+    uint32_t cols = 0;
+    uint32_t rows = 0;
+    std::vector<uint8_t> occupied;
+    std::vector<uint32_t> free_slots;
+    size_t remaining = 0;
+
+    void build(const std::map<uint32_t, std::shared_ptr<Soldier>> &soldiers);
+};
+
+#endif  // SPAWNPLACER_H_
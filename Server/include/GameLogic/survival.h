@@ -2,6 +2,7 @@
 #define SURVIVAL_H_
 
 #include "match.h"
+#include "wavedirector.h"
 
 /* En el modo “survival”, a medida que pasa el tiempo aparecen más y más infectados y estos se van
 haciendo progresivamente más fuertes, resistentes y veloces.
@@ -17,9 +18,8 @@ public:
     void configurate(uint8_t difficulty);
 
     void simulateStep(std::chrono::_V2::system_clock::time_point real_time) override;
-    void add_zombies(void);
     void loseMatch(void);
-    std::chrono::_V2::system_clock::time_point actual_time = create_time;
+    WaveDirector director;
 };
 
 #endif  // SURVIVAL_H_
@@ -0,0 +1,61 @@
+#ifndef VEC2_H_
+#define VEC2_H_
+
+#include "position.h"
+
+#include <cmath>
+
+/* Vector 2D para las cuentas de movimiento y deteccion.
+Las comparaciones de distancia se hacen con lengthSq (sin raiz); la raiz solo
+se paga al normalizar. Todo es inline y sin ramas para que los loops que lo
+usan se puedan vectorizar.
+El mapa es circular en x: wrapDelta devuelve la diferencia mas corta. */
+
+struct Vec2 {
+    double x;
+    double y;
+
+    Vec2 operator+(const Vec2 &other) const { return Vec2{x + other.x, y + other.y}; }
+    Vec2 operator-(const Vec2 &other) const { return Vec2{x - other.x, y - other.y}; }
+    Vec2 operator*(double k) const { return Vec2{x * k, y * k}; }
+    Vec2& operator+=(const Vec2 &other) { x += other.x; y += other.y; return *this; }
+
+    double dot(const Vec2 &other) const { return x * other.x + y * other.y; }
+    double lengthSq(void) const { return x * x + y * y; }
+    double length(void) const { return std::sqrt(lengthSq()); }
+
+    /* Mismo sentido y largo 1, el vector nulo queda nulo */
+    Vec2 normalized(void) const {
+        double length_2 = lengthSq();
+        double inverse = (length_2 > 0) ? 1.0 / std::sqrt(length_2) : 0.0;
+        return *this * inverse;
+    }
+
+    /* Lo achica a largo max_length si es mas largo, sino lo deja igual */
+    Vec2 clamped(double max_length) const {
+        double length_2 = lengthSq();
+        double scale = (length_2 > max_length * max_length) ? max_length / std::sqrt(length_2) : 1.0;
+        return *this * scale;
+    }
+};
+
+/* Diferencia to - from en un eje circular de periodo period (infinito = no circular).
+Supone que ambas coordenadas estan dentro del mapa */
+inline double wrapDelta(double from, double to, double period) {
+    double delta = to - from;
+    double half = period * 0.5;
+    delta -= (delta > half) ? period : 0.0;
+    delta += (delta < -half) ? period : 0.0;
+    return delta;
+}
+
+/* Vector mas corto de from a to, dando la vuelta al mapa en x si conviene */
+inline Vec2 delta(const Position &from, const Position &to) {
+    return Vec2{wrapDelta(from.x, to.x, from.period), to.y - from.y};
+}
+
+inline double distanceSq(const Position &from, const Position &to) {
+    return delta(from, to).lengthSq();
+}
+
+#endif  // VEC2_H_
@@ -0,0 +1,73 @@
+#ifndef WAVEDIRECTOR_H_
+#define WAVEDIRECTOR_H_
+
+#include "Zombies/zombiefactory.h"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
+class Match;
+
+/* Director de oleadas del modo survival.
+Cada interval segundos arma una oleada: la composicion de la dificultad
+multiplicada por 1 + growth * numero de oleada. No la crea de golpe: la encola
+y en cada tick crea como mucho max_per_tick zombies sin pasarse de budget,
+asi el comienzo de una oleada no dispara el tiempo del tick.
+En los ticks sin oleada pendiente crea zombies de antemano (pool), que es lo
+caro porque la fabrica lee la configuracion de cada tipo. */
+
+class WaveDirector {
+public:
+    /* Parámetros: segundos entre oleadas, crecimiento por oleada, zombies por tick,
+    milisegundos por tick y zombies precreados por tipo */
+    void configure(double interval, double growth, size_t max_per_tick,
+        double budget_ms, size_t prewarm);
+
+    /* Cantidad de cada tipo en la primera oleada, parámetros: pares (tipo, cantidad) */
+    void setComposition(const std::vector<std::pair<uint8_t, uint32_t>>& composition);
+
+    /* Empieza a contar el tiempo hasta la primera oleada */
+    void start(std::chrono::_V2::system_clock::time_point now);
+
+    /* Lanza la oleada que toca, sin esperar el intervalo */
+    void launchWave(void);
+
+    /* Avanza el director un tick: lanza oleadas y crea lo que entra en el presupuesto */
+    void step(std::chrono::_V2::system_clock::time_point real_time, Match &match);
+
+    /* Zombies de oleadas lanzadas que todavia no entraron a la partida */
+    size_t pending(void) const;
+
+    /* Zombies precreados esperando */
+    size_t pooled(void) const;
+
+    uint32_t wavesLaunched(void) const;
+
+private:
+    ZombieFactory factory;
+    std::chrono::duration<double> interval{30.0};
+    double growth = 0;
+    size_t max_per_tick = 1;
+    std::chrono::duration<double> budget{0.002};
+    size_t prewarm = 0;
+    std::vector<std::pair<uint8_t, uint32_t>> composition;
+    std::chrono::_V2::system_clock::time_point last_wave;
+    uint32_t waves = 0;
+    // tipos a crear, intercalados para que una oleada a medias ya venga mezclada
+    std::deque<uint8_t> queue;
+    std::map<uint8_t, std::vector<std::shared_ptr<Zombie>>> pool;
+
+    void spawn(uint8_t type, std::chrono::_V2::system_clock::time_point real_time,
+        Match &match, double mass_center);
+
+    /* Precrea un zombie del tipo que menos tiene en el pool, false si estan todos llenos */
+    bool prewarmOne(void);
+};
+
+#endif  // WAVEDIRECTOR_H_
@@ -0,0 +1,53 @@
+#ifndef WORKERPOOL_H_
+#define WORKERPOOL_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/* Pool de hilos fijo para repartir un for en tandas (chunks).
+El hilo que llama tambien trabaja, como carril 0; los del pool son 1..workers.
+parallelFor bloquea hasta que se procesaron todas las tandas. */
+
+class WorkerPool {
+public:
+    using Job = std::function<void(size_t begin, size_t end, size_t lane)>;
+
+    explicit WorkerPool(size_t workers);
+    ~WorkerPool();
+
+    /* Cantidad de carriles: los hilos del pool mas el que llama */
+    size_t lanes(void) const;
+
+    /* Reparte [0, count) en tandas de chunk y corre job sobre cada una.
+    Si un job tira una excepcion se relanza en el hilo que llamo */
+    void parallelFor(size_t count, size_t chunk, const Job& job);
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+private:
+    std::vector<std::thread> threads;
+    std::mutex mtx;
+    std::condition_variable work_cv;
+    std::condition_variable done_cv;
+    const Job* job = nullptr;
+    size_t count = 0;
+    size_t chunk = 1;
+    std::atomic<size_t> next{0};
+    size_t busy = 0;
+    uint64_t generation = 0;
+    bool stopping = false;
+    std::exception_ptr error;
+
+    void workerLoop(size_t lane);
+    void drain(size_t lane);
+};
+
+#endif  // WORKERPOOL_H_
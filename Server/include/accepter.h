@@ -8,23 +8,41 @@
 #include <utility>
 #include "../../libs/thread.h"
 #include "../../Common/include/Socket/socket_game.h"
+#include "../../Common/include/Socket/socket_options.h"
 #include "game.h"
 #include "receiver.h"
 #include "game_manager.h"
+#include "admission.h"
+
+/* Acepta clientes en un socket pasivo propio. Puede haber varios en el mismo
+puerto (SO_REUSEPORT): comparten el GameManager y el cupo de conexiones. */
 
 class Accepter: public Thread {
 private:
     GameSocket skt;
-    GameManager game_manager;
+    GameManager& game_manager;
+    Admission& admission;
     std::list<Receiver*> clients;
+    // opciones de cada cliente aceptado, de la seccion socket del config
+    SocketOptions options;
+    // cada cuanto se liberan los Receiver terminados aunque no lleguen clientes
+    int reap_ms;
+
+    static SocketOptions loadSocketOptions();
+
+    /* Le da un Receiver al cliente o, sin cupo, le avisa y lo cierra */
+    void admit(GameSocket&& peer);
 
+    /* Sin fds o memoria: libera los terminados y espera reap_ms */
+    void backOff(const char* reason);
     void killAll();
     void reapDead();
 protected:
     virtual void run() override;
 
 public:
-    explicit Accepter(const std::string& servname);
+    Accepter(const std::string& servname, int backlog, bool reuse_port, int reap_ms,
+             GameManager& game_manager, Admission& admission);
 
     void stop();
 
@@ -0,0 +1,33 @@
+#ifndef ADMISSION_H_
+#define ADMISSION_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+/* Cupo de conexiones compartido por todos los Accepter. Cada cliente
+aceptado ocupa un lugar hasta que su Receiver se libera; los que llegan
+con el cupo lleno reciben FEEDBACK_SERVER_FULL y se cierran, asi una
+avalancha de conexiones no crea hilos sin limite. */
+
+class Admission {
+    const std::size_t max_connections;
+    std::atomic<std::size_t> connections;
+    std::atomic<std::uint64_t> rejected;
+
+public:
+    explicit Admission(std::size_t max_connections);
+
+    /* Ocupa un lugar si queda alguno */
+    bool tryAdmit();
+
+    void release();
+
+    [[nodiscard]] std::size_t active() const;
+    [[nodiscard]] std::uint64_t rejectedCount() const;
+
+    Admission(const Admission&) = delete;
+    Admission& operator=(const Admission&) = delete;
+};
+
+#endif  // ADMISSION_H_
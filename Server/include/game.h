@@ -2,6 +2,9 @@
 #define GAME_H_
 
 #include <atomic>
+#include <map>
+#include <memory>
+#include <vector>
 #include "../../Common/include/Information/information.h"
 #include "../../libs/queue.h"
 #include "../../libs/thread.h"
@@ -9,37 +12,65 @@
 #include "GameLogic/survival.h"
 #include "GameLogic/clearthezone.h"
 #include "Command/command_ingame.h"
+#include "snapshot_rate.h"
+#include "lobby_index.h"
+#include "../../Common/include/Information/game_summary_dto.h"
 #include "../../Common/include/Information/information.h"
 
 class Game : public Thread {
     // std::vector<std::uint8_t> admins;
     std::uint8_t max_players;
     std::atomic<std::uint8_t> players_amount;
+    // los que siguen conectados, es lo que se muestra en el lobby
+    std::atomic<std::uint8_t> connected;
     std::atomic<bool> is_running;
     std::atomic<bool> started;
+    // termino el hilo, ya no se puede unir nadie
+    std::atomic<bool> finished;
+    std::uint8_t mode;
+    std::uint8_t difficulty;
+    std::uint32_t code;
     uint8_t actor = 0;
     //uint8_t zactor = 3;
     bool zombies = false;
 
     Queue<std::shared_ptr<InGameCommand>> commands_recv;
-    std::vector<
+    // (player_id, cola del jugador). El id hace falta para filtrar por su ventana.
+    std::map<std::uint8_t,
       std::shared_ptr<
         Queue<std::shared_ptr<Information>>>> player_queues;
+    // Tasa de snapshots de cada jugador, la ajusta su Sender. Sin tasa se manda siempre.
+    std::map<std::uint8_t, std::shared_ptr<SnapshotRate>> player_rates;
+    // colas de todos los que se unieron: mientras alguna viva su Receiver
+    // puede seguir usando commands_recv
+    std::vector<std::weak_ptr<Queue<std::shared_ptr<Information>>>> members;
 
     std::shared_ptr<Match> match;
+    // donde se lista la partida mientras se pueda unir alguien, puede ser nullptr
+    LobbyIndex* lobby;
 
     std::mutex mtx;
+
+    /* Actualiza la entrada del lobby, o la saca si ya no se puede unir nadie.
+    Se llama con mtx tomado, asi los cambios de una partida no se pisan */
+    void publish();
+    /* Saca al jugador que se fue. Se llama con mtx tomado */
+    void dropPlayer(std::uint8_t player_id);
 protected:
     virtual void run() override;
 
 public:
-    explicit Game(std::uint8_t max_players, uint8_t gameMode, uint8_t gameDifficulty, uint32_t game_code);
+    explicit Game(std::uint8_t max_players, uint8_t gameMode, uint8_t gameDifficulty, uint32_t game_code,
+                  LobbyIndex* lobby = nullptr);
 
     // bool addAdmin(std::uint8_t player_id);
     [[nodiscard]] bool isFull() const;
 
-    void join(Queue<std::shared_ptr<InGameCommand>> *&game_queue, const std::shared_ptr<Queue<std::shared_ptr<Information>>> &player_queue,
-              std::uint8_t* player_id);
+    /* Devuelve false si esta llena o ya termino, chequeado bajo el mismo lock
+    que la une. accepted se le encola al jugador antes que cualquier snapshot */
+    bool join(Queue<std::shared_ptr<InGameCommand>> *&game_queue, const std::shared_ptr<Queue<std::shared_ptr<Information>>> &player_queue,
+              std::uint8_t* player_id, const std::shared_ptr<SnapshotRate> &rate = nullptr,
+              const std::shared_ptr<Information> &accepted = nullptr);
     
     void selectMode(uint8_t gameMode, uint8_t gameDifficulty, uint32_t game_mode);
 
@@ -47,6 +78,14 @@ public:
 
     [[nodiscard]] bool isEmpty() const;
 
+    [[nodiscard]] bool isFinished() const;
+
+    /* Termino y se fueron todos sus clientes: se puede liberar */
+    [[nodiscard]] bool isDone();
+
+    /* Como se ve la partida en el lobby */
+    [[nodiscard]] GameSummaryDTO summary() const;
+
     ~Game() override;
 };
 
@@ -3,30 +3,78 @@
 
 #include <vector>
 #include <map>
+#include <chrono>
+#include <condition_variable>
+#include <thread>
 #include "game.h"
 #include "GameLogic/match.h"
 #include "../../Common/include/Information/information.h"
 #include "Command/command_ingame.h"
+#include "snapshot_rate.h"
+#include "lobby_index.h"
+#include "matchmaker.h"
 
 class GameManager {
     std::map<std::uint32_t,Game*> games;
     std::mutex mtx;
+    // partidas simultaneas que se permiten
+    std::size_t max_games;
+    // partidas abiertas por modo y dificultad, se consulta sin tomar mtx
+    LobbyIndex lobby;
+    std::size_t list_max;
+    Matchmaker matchmaker;
+    // sacadas de games, el reaper las frena y libera fuera del lock
+    std::vector<Game*> finished_games;
+    std::chrono::milliseconds reap_period;
+    std::condition_variable reap_cv;
+    bool stopping;
+    std::thread reaper;
 
     [[nodiscard]] std::uint32_t generateGameCode();
 
-    void cleanEmptyGames();
+    /* Pasa a finished_games las partidas terminadas. Se llama con mtx tomado */
+    void takeFinishedGames();
+    void reap();
     void cleanAllGames();
 public:
-    explicit GameManager();
+    /* reap_ms: cada cuanto se liberan las partidas terminadas.
+    list_max: partidas maximas por respuesta a listGames.
+    match_players / match_wait_ms: jugadores que junta la partida rapida
+    antes de crear una y cuanto espera como maximo */
+    explicit GameManager(std::size_t max_games = 10000, int reap_ms = 500, std::size_t list_max = 50,
+                         std::size_t match_players = 4, int match_wait_ms = 3000);
 
+    /* Devuelve el codigo de la partida, o 0 si ya hay max_games: en ese caso
+    el jugador recibe un FEEDBACK_SERVER_FULL y puede seguir intentando */
     std::uint32_t createGame(Queue<std::shared_ptr<InGameCommand>> *&game_queue,
                              const std::shared_ptr<Queue<std::shared_ptr<Information>>> &player_queue,
-                             std::uint8_t* player_id, uint8_t gameMode, uint8_t gameDifficulty);
+                             std::uint8_t* player_id, uint8_t gameMode, uint8_t gameDifficulty,
+                             const std::shared_ptr<SnapshotRate> &rate = nullptr);
 
     bool joinGame(Queue<std::shared_ptr<InGameCommand>> *&game_queue,
                   const std::shared_ptr<Queue<std::shared_ptr<Information>>> &player_queue,
                   std::uint8_t* player_id,
-                  std::uint32_t game_code);
+                  std::uint32_t game_code,
+                  const std::shared_ptr<SnapshotRate> &rate = nullptr);
+
+    /* Une al jugador a la partida abierta mas llena de ese modo y dificultad.
+    Si no hay ninguna devuelve false sin mandarle nada */
+    bool joinOpenGame(Queue<std::shared_ptr<InGameCommand>> *&game_queue,
+                      const std::shared_ptr<Queue<std::shared_ptr<Information>>> &player_queue,
+                      std::uint8_t* player_id, uint8_t gameMode, uint8_t gameDifficulty,
+                      const std::shared_ptr<SnapshotRate> &rate = nullptr);
+
+    /* Partida rapida, ver Matchmaker. Bloquea hasta ubicar al jugador */
+    bool quickMatch(Queue<std::shared_ptr<InGameCommand>> *&game_queue,
+                    const std::shared_ptr<Queue<std::shared_ptr<Information>>> &player_queue,
+                    std::uint8_t* player_id, uint8_t gameMode, uint8_t gameDifficulty,
+                    const std::shared_ptr<SnapshotRate> &rate = nullptr);
+
+    /* Partidas a las que todavia se puede unir. LOBBY_ANY no filtra */
+    [[nodiscard]] std::vector<GameSummaryDTO> listGames(std::uint8_t mode, std::uint8_t difficulty) const;
+
+    GameManager(const GameManager&) = delete;
+    GameManager& operator=(const GameManager&) = delete;
 
     ~GameManager();
 };
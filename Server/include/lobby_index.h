@@ -0,0 +1,64 @@
+#ifndef LOBBY_INDEX_H_
+#define LOBBY_INDEX_H_
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <shared_mutex>
+#include <vector>
+#include "../../Common/include/Information/game_summary_dto.h"
+
+// filtro que acepta cualquier modo o dificultad
+constexpr std::uint8_t LOBBY_ANY = 0xFF;
+
+/* Partidas a las que todavia se puede unir, separadas en un balde por modo
+y dificultad. Cada balde tiene su propio lock de lectura/escritura: listar
+no frena a los que crean o se unen en otros baldes y no se recorren las
+partidas llenas ni las de otros modos. */
+
+class LobbyIndex {
+    // mas jugadores primero: la mas llena es la primera
+    using ByPlayers = std::multimap<std::uint8_t, std::uint32_t, std::greater<>>;
+    struct OpenGame {
+        GameSummaryDTO summary;
+        ByPlayers::iterator rank;
+    };
+    struct Bucket {
+        mutable std::shared_mutex mtx;
+        std::map<std::uint32_t, OpenGame> open;
+        ByPlayers by_players;
+    };
+    static constexpr std::size_t MODES = 2;
+    static constexpr std::size_t DIFFICULTIES = 4;
+    std::array<Bucket, MODES * DIFFICULTIES> buckets;
+
+    // nullptr si el modo o la dificultad no existen: esa partida no se lista
+    Bucket* bucketFor(std::uint8_t mode, std::uint8_t difficulty);
+    const Bucket* bucketFor(std::uint8_t mode, std::uint8_t difficulty) const;
+    void collect(const Bucket& bucket, std::size_t max_results,
+                 std::vector<GameSummaryDTO>& result) const;
+    // con el lock de escritura del balde tomado
+    static void erase(Bucket& bucket, std::uint32_t game_code);
+
+public:
+    LobbyIndex() = default;
+
+    /* Agrega o actualiza la partida; si se lleno la saca */
+    void update(const GameSummaryDTO& game);
+
+    void remove(std::uint32_t game_code, std::uint8_t mode, std::uint8_t difficulty);
+
+    /* Hasta max_results partidas abiertas, LOBBY_ANY no filtra */
+    [[nodiscard]] std::vector<GameSummaryDTO> list(std::uint8_t mode, std::uint8_t difficulty,
+                                                   std::size_t max_results) const;
+
+    /* La partida abierta con mas jugadores de ese modo y dificultad, sin
+    recorrer el balde. Devuelve false si no hay ninguna */
+    bool fullest(std::uint8_t mode, std::uint8_t difficulty, GameSummaryDTO* game) const;
+
+    LobbyIndex(const LobbyIndex&) = delete;
+    LobbyIndex& operator=(const LobbyIndex&) = delete;
+};
+
+#endif  // LOBBY_INDEX_H_
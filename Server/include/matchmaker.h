@@ -0,0 +1,76 @@
+#ifndef MATCHMAKER_H_
+#define MATCHMAKER_H_
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "../../Common/include/Information/information.h"
+#include "../../libs/queue.h"
+#include "Command/command_ingame.h"
+#include "snapshot_rate.h"
+
+class GameManager;
+
+/* Partida rapida: una cola de espera por modo y dificultad.
+Cada pedido entra primero a la partida abierta mas llena de su modo. Si no
+hay ninguna espera: cuando se juntan min_players (o el que espera pasa
+max_wait) el primero crea la partida y los demas se unen a ella. Asi hay
+mas jugadores por partida y hacen falta menos hilos de simulacion.
+Los que se desconectan mientras esperan (su cola se cerro) no cuentan para
+el grupo, y el grupo se ubica fuera del lock para no frenar a los demas. */
+
+class Matchmaker {
+    struct Ticket {
+        std::shared_ptr<Queue<std::shared_ptr<Information>>> player_queue;
+        std::shared_ptr<SnapshotRate> rate;
+        Queue<std::shared_ptr<InGameCommand>>* game_queue;
+        std::uint8_t player_id;
+        // salio de la espera, lo esta ubicando startGroup
+        bool taken;
+        // ya se ubico (o no se pudo), joined dice si quedo en una partida
+        bool done;
+        bool joined;
+    };
+    GameManager& game_manager;
+    std::size_t min_players;
+    std::chrono::milliseconds max_wait;
+    std::mutex mtx;
+    std::condition_variable matched;
+    // clave: modo * 256 + dificultad
+    std::map<std::uint16_t, std::vector<std::shared_ptr<Ticket>>> waiting;
+    // grupos que se estan ubicando sin el lock y pedidos en espera, stop() los espera
+    std::size_t placing;
+    std::size_t waiters;
+    bool closed;
+
+    void place(Ticket& ticket, std::uint8_t mode, std::uint8_t difficulty);
+    /* Saca del grupo a los que se desconectaron y los despierta */
+    void dropDisconnected(std::vector<std::shared_ptr<Ticket>>& group);
+    /* Saca al grupo de la espera, lo ubica con el lock suelto y despierta a
+    todos. Se llama con lck tomado y vuelve con lck tomado */
+    void startGroup(std::unique_lock<std::mutex>& lck, std::vector<std::shared_ptr<Ticket>>& group,
+                    std::uint8_t mode, std::uint8_t difficulty);
+
+public:
+    Matchmaker(GameManager& game_manager, std::size_t min_players, int max_wait_ms);
+
+    /* Bloquea hasta ubicar al jugador. Devuelve si quedo en una partida;
+    si no (servidor lleno o se fue) ya recibio el feedback correspondiente */
+    bool match(std::uint8_t mode, std::uint8_t difficulty,
+               Queue<std::shared_ptr<InGameCommand>> *&game_queue,
+               const std::shared_ptr<Queue<std::shared_ptr<Information>>> &player_queue,
+               std::uint8_t* player_id, const std::shared_ptr<SnapshotRate> &rate);
+
+    /* Despierta a los que esperan (quedan sin partida), espera a los grupos
+    que se estan ubicando y no acepta mas pedidos */
+    void stop();
+
+    Matchmaker(const Matchmaker&) = delete;
+    Matchmaker& operator=(const Matchmaker&) = delete;
+};
+
+#endif  // MATCHMAKER_H_
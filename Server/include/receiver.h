@@ -36,7 +36,7 @@ protected:
     virtual void run() override;
 
 public:
-    explicit Receiver(GameSocket&& peer, GameManager& game_manager);
+    Receiver(GameSocket&& peer, GameManager& game_manager, const SocketOptions& options);
 
     [[nodiscard]] bool isDead() const;
 
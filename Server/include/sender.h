@@ -4,20 +4,99 @@
 #define SENDER_H_
 
 #include <atomic>
+#include <chrono>
+#include <deque>
+#include <memory>
+#include <utility>
 #include <vector>
 #include "../../libs/thread.h"
 #include "../../libs/queue.h"
 #include "protocol.h"
 #include "../../Common/include/Information/information.h"
+#include "../../Common/include/Socket/socket_datagram.h"
+#include "../../Common/include/Socket/buffer_pool.h"
+#include "../../Common/include/Socket/frame_compression.h"
+#include "../../Common/include/Information/feedback_server_compression.h"
+#include "snapshot_rate.h"
 
 class Sender: public Thread {
 private:
     Protocol protocol;
+    GameSocket& socket;
     Queue<std::shared_ptr<Information>>& game_state_queue;
 
+    // Lo que hay en la cola se serializa en buffers del pool y sale con un
+    // solo sendmsg por vuelta (un tick).
+    using Buffer = std::unique_ptr<std::vector<std::int8_t>>;
+    BufferPool pool;
+    std::size_t batch_max;
+    std::vector<Buffer> pending;
+    std::vector<struct iovec> iovecs;
+    // Con zero copy los buffers quedan en vuelo hasta que el kernel los suelta.
+    bool zerocopy_enabled;
+    std::size_t zerocopy_min_bytes;
+    std::deque<std::pair<std::uint32_t, std::vector<Buffer>>> in_flight;
+    // Se mide el socket cada tanto y se ajusta la tasa de snapshots.
+    std::shared_ptr<SnapshotRate> rate;
+    std::chrono::milliseconds measure_every;
+    std::chrono::steady_clock::time_point last_measure;
+
+    /* Le informa a la tasa el backlog y el RTT del socket, si ya toca medir */
+    void measureLink();
+
     std::atomic<bool> is_running;
     std::atomic<bool> keep_talking;
 
+    // Canal UDP para los snapshots, se abre despues del join si esta habilitado.
+    bool datagram_enabled;
+    std::size_t max_datagram;
+    double datagram_loss;
+    std::unique_ptr<DatagramSocket> datagram;
+    std::uint32_t datagram_token;
+    std::uint32_t datagram_sequence;
+    bool datagram_ready;
+    std::vector<std::int8_t> datagram_buffer;
+    // Snapshots en el formato compacto (ver GameStateFeedback::serializeCompact).
+    bool compact_state;
+    // Compresion negociada: los mensajes de compression_min_bytes o mas van
+    // comprimidos con un stream que dura toda la conexion.
+    bool compression_enabled;
+    std::size_t compression_min_bytes;
+    int compression_level;
+    std::unique_ptr<FrameDeflater> deflater;
+
+    /* Contesta el pedido del cliente y, si se acepta, arranca a comprimir */
+    void answerCompression(const CompressionFeedback& request);
+
+    /* Arma el FEEDBACK_COMPRESSED con el mensaje serializado en raw */
+    Buffer compressFrame(Buffer raw);
+
+    /* Serializa el feedback al final de result, los snapshots en formato compacto si corresponde */
+    void serializeFeedInto(const Information& feed, std::vector<std::int8_t>& result) const;
+
+    /* Serializa el feedback y lo deja pendiente (o lo manda por UDP).
+    Devuelve true si despues hay que ofrecer el canal UDP. */
+    bool queueFeed(const Information& feed);
+
+    /* Manda todo lo pendiente con una sola llamada */
+    void flush();
+
+    /* Devuelve al pool los buffers que el kernel ya no usa */
+    void reclaimZeroCopy();
+
+    /* try_pop que no tira si la cola se cerro: el pop siguiente se entera */
+    bool tryPopQueued(std::shared_ptr<Information>& feed);
+
+    /* El cliente no recibe mas: corta el socket y cierra la cola para que
+    el Receiver y la partida lo suelten, no solo este hilo */
+    void disconnect();
+
+    /* Abre el puerto UDP y le manda la oferta al cliente por TCP */
+    void offerDatagramChannel();
+
+    /* Manda el snapshot por UDP si el cliente ya acepto y entra en un datagrama */
+    bool sendByDatagram(const std::vector<std::int8_t>& serialized);
+
 protected:
     void run() override;
 
@@ -26,6 +105,9 @@ public:
 
     bool isDead() const;
 
+    /* La tasa de snapshots de este cliente, para pasarsela al Game */
+    [[nodiscard]] const std::shared_ptr<SnapshotRate>& snapshotRate() const;
+
     void stop();
 
     Sender(const Sender&) = delete;
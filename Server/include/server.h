@@ -1,10 +1,19 @@
 #ifndef SERVER_H_
 #define SERVER_H_
 
+#include <memory>
+#include <string>
+#include <vector>
 #include "accepter.h"
+#include "admission.h"
+#include "game_manager.h"
+#include "yaml-cpp/yaml.h"
 
 class Server {
-    Accepter accepter;
+    YAML::Node config;
+    GameManager game_manager;
+    Admission admission;
+    std::vector<std::unique_ptr<Accepter>> accepters;
 
 public:
     explicit Server(const std::string& servname);
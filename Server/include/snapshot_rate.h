@@ -0,0 +1,57 @@
+#ifndef SNAPSHOT_RATE_H_
+#define SNAPSHOT_RATE_H_
+
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+
+/* Tasa de snapshots de un cliente. La comparten su Sender y el Game.
+El Sender informa cuanto quedo sin salir del socket y el RTT; si el enlace
+esta congestionado se duplica el paso (se manda 1 de cada stride ticks) y
+cuando se despeja se vuelve de a uno. El Game pregunta en cada tick si al
+cliente le toca y deja de encolarle si ya tiene max_pending sin mandar,
+asi un cliente lento se degrada en vez de llenar la cola y ser echado. */
+
+class SnapshotRate {
+    const std::uint32_t max_stride;
+    const std::size_t backlog_high;
+    const std::uint32_t rtt_high_us;
+    const std::int32_t max_pending;
+    const std::uint32_t recover_after;
+
+    std::atomic<std::uint32_t> stride;
+    std::atomic<std::int32_t> pending;
+    // solo los toca el Game
+    std::uint32_t tick;
+    // solo los toca el Sender
+    std::uint32_t clear_reports;
+
+public:
+    /* parámetros: paso maximo, bytes sin salir y RTT (us) que se consideran
+    congestion, snapshots encolados maximos y cuantos reportes limpios
+    seguidos hacen falta para bajar el paso */
+    SnapshotRate(std::uint32_t max_stride, std::size_t backlog_high, std::uint32_t rtt_high_us,
+                 std::int32_t max_pending, std::uint32_t recover_after);
+
+    /* Game: si en este tick se le arma un snapshot */
+    bool shouldSend();
+
+    /* Game: se encolo un snapshot (o se deshace si no entro) */
+    void enqueued();
+    void dropped();
+
+    /* Sender: se saco un snapshot de la cola */
+    void dequeued();
+
+    /* Sender: estado del socket despues de un envio */
+    void report(std::size_t backlog_bytes, std::uint32_t rtt_us);
+
+    [[nodiscard]] std::uint32_t getStride() const;
+
+    [[nodiscard]] std::int32_t getPending() const;
+
+    SnapshotRate(const SnapshotRate&) = delete;
+    SnapshotRate& operator=(const SnapshotRate&) = delete;
+};
+
+#endif  // SNAPSHOT_RATE_H_
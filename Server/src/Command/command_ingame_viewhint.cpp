@@ -0,0 +1,11 @@
+#include "../../include/Command/command_ingame_viewhint.h"
+
+ViewHintCommand::ViewHintCommand(std::uint8_t player_id, std::int32_t window_x, std::uint16_t window_width) :
+    InGameCommand(player_id),
+    window_x(window_x),
+    window_width(window_width) {
+}
+
+void ViewHintCommand::execute(std::shared_ptr<Match> &match) const {
+    match->setViewHint(player_id, window_x, window_width);
+}
@@ -0,0 +1,15 @@
+#include "../../include/Command/command_pregame_compression.h"
+#include "../../../Common/include/Information/feedback_server_compression.h"
+
+CompressionCommand::CompressionCommand(std::uint8_t codec) :
+    codec(codec) {
+}
+
+bool CompressionCommand::execute(GameManager &game_manager,
+                                 Queue<std::shared_ptr<InGameCommand>> *&game_queue,
+                                 const std::shared_ptr<Queue<std::shared_ptr<Information>>> &player_queue,
+                                 std::uint8_t *player_id,
+                                 const std::shared_ptr<SnapshotRate> &rate) {
+    player_queue->push(std::make_shared<CompressionFeedback>(codec));
+    return false;
+}
@@ -12,12 +12,14 @@ CreateGameCommand::CreateGameCommand(uint8_t gameMode, std::uint8_t gameDifficul
 bool CreateGameCommand::execute(GameManager &game_manager,
                                 Queue<std::shared_ptr<InGameCommand>> *&game_queue,
                                 const std::shared_ptr<Queue<std::shared_ptr<Information>>> &player_queue,
-                                std::uint8_t *player_id) {
-    // Creates the game.
-    game_manager.createGame(game_queue,
-                            player_queue,
-                            player_id,
-                            gameMode,
-                            gameDifficulty);
-    return true;
+                                std::uint8_t *player_id,
+                                const std::shared_ptr<SnapshotRate> &rate) {
+    // Creates the game (0 si el servidor no admite mas partidas).
+    std::uint32_t game_code = game_manager.createGame(game_queue,
+                                                      player_queue,
+                                                      player_id,
+                                                      gameMode,
+                                                      gameDifficulty,
+                                                      rate);
+    return game_code != 0;
 }
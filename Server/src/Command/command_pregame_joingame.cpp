@@ -10,7 +10,8 @@ JoinGameCommand::JoinGameCommand(std::uint32_t game_code) :
 bool JoinGameCommand::execute(GameManager &game_manager,
                               Queue<std::shared_ptr<InGameCommand>> *&game_queue,
                               const std::shared_ptr<Queue<std::shared_ptr<Information>>> &player_queue,
-                              std::uint8_t *player_id) {
+                              std::uint8_t *player_id,
+                              const std::shared_ptr<SnapshotRate> &rate) {
     return game_manager.joinGame(game_queue, player_queue,
-                                 player_id, game_code);
+                                 player_id, game_code, rate);
 }
@@ -0,0 +1,16 @@
+#include "../../include/Command/command_pregame_listgames.h"
+#include "../../../Common/include/Information/feedback_server_gamelist.h"
+
+ListGamesCommand::ListGamesCommand(std::uint8_t mode, std::uint8_t difficulty) :
+    mode(mode),
+    difficulty(difficulty) {
+}
+
+bool ListGamesCommand::execute(GameManager &game_manager,
+                               Queue<std::shared_ptr<InGameCommand>> *&game_queue,
+                               const std::shared_ptr<Queue<std::shared_ptr<Information>>> &player_queue,
+                               std::uint8_t *player_id,
+                               const std::shared_ptr<SnapshotRate> &rate) {
+    player_queue->push(std::make_shared<GameListFeedback>(game_manager.listGames(mode, difficulty)));
+    return false;
+}
@@ -0,0 +1,14 @@
+#include "../../include/Command/command_pregame_quickmatch.h"
+
+QuickMatchCommand::QuickMatchCommand(std::uint8_t gameMode, std::uint8_t gameDifficulty) :
+    gameMode(gameMode),
+    gameDifficulty(gameDifficulty) {
+}
+
+bool QuickMatchCommand::execute(GameManager &game_manager,
+                                Queue<std::shared_ptr<InGameCommand>> *&game_queue,
+                                const std::shared_ptr<Queue<std::shared_ptr<Information>>> &player_queue,
+                                std::uint8_t *player_id,
+                                const std::shared_ptr<SnapshotRate> &rate) {
+    return game_manager.quickMatch(game_queue, player_queue, player_id, gameMode, gameDifficulty, rate);
+}
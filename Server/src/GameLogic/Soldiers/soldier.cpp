@@ -2,10 +2,12 @@
 #include "../../../include/GameLogic/Zombies/zombie.h"
 #include "../../../include/GameLogic/Throwables/throwablesfactory.h"
 #include "../../../include/GameLogic/Throwables/throwable.h"
+#include "../../../include/GameLogic/damagebuffer.h"
 #include <random>
 #include <tuple>
 #define LIVES 2
 #define TEAM_RANGE 500
+#define SOLDIER_SPAWN_RANGE 100
 
 /* CONSTRUCTOR */
 
@@ -104,6 +106,10 @@ void Soldier::throwGrenade(uint8_t state){
 void Soldier::recvDamage(uint8_t state, double damage) {
     switch(state) {
         case ON:
+            if (damage_buffer != nullptr) {
+                damage_buffer->toSoldier(soldier_id, damage);
+                break;
+            }
             reloading = throwing = reviving = throwed = false;
             being_hurt = true;
             damage_recv = damage;
@@ -114,6 +120,19 @@ void Soldier::recvDamage(uint8_t state, double damage) {
     }
 }
 
+void Soldier::applyDamage(std::chrono::_V2::system_clock::time_point real_time, double damage) {
+    if (dying || !alive) return;
+    reloading = throwing = reviving = throwed = false;
+    if (damage < actual_health) {
+        actual_health -= damage;
+        being_hurt = true;
+        damage_recv = 0.0;
+        return;
+    }
+    death_time = real_time;
+    start_dying(ON);
+}
+
 void Soldier::start_dying(uint8_t state) {
     switch(state) {
         case ON:
@@ -281,7 +300,7 @@ void Soldier::simulateMove(
 
     // verifico las colisiones.
     for (auto i = soldiers.begin(); i != soldiers.end(); i++) {
-        Position other_pos = i->second->getPosition();
+        const Position &other_pos = i->second->getPosition();
         if (i->second->getId() == soldier_id) continue;
         if (i->second->isDead()) continue;
         if (next_pos.collides(other_pos)) {
@@ -290,7 +309,7 @@ void Soldier::simulateMove(
     }
     // lo mismo con los zombies
     for (auto i = zombies.begin(); i != zombies.end(); i++) {
-        Position other_pos = i->second->getPosition();
+        const Position &other_pos = i->second->getPosition();
         if (i->second->isDying() || i->second->isDead()) continue;
         if (next_pos.collides(other_pos)) {
             return;
@@ -430,34 +449,7 @@ void Soldier::setPosition(Position&& new_pos) {
     position = new_pos;
 }
 
-void Soldier::setRandomPosition(
-        const std::map<uint32_t, std::shared_ptr<Soldier>> &soldiers,
-        const std::map<uint32_t, std::shared_ptr<Zombie>> &zombies, double mass_center, double dim_x, double dim_y) {
-    using std::random_device;
-    using std::mt19937;
-    using std::uniform_int_distribution;
-    using std::uint32_t;
-
-    random_device rd;
-    mt19937 mt(rd());
-    uniform_int_distribution<int32_t> distx(mass_center - 100, mass_center + 100);
-    uniform_int_distribution<int32_t> disty(0, dim_y);
-    int32_t x_pos;
-    int32_t y_pos;
-    bool collides;
-    do {
-        collides = false;
-        x_pos = distx(mt);
-        y_pos = disty(mt);
-        Position _position(x_pos, y_pos, getWidth(), getHeight(), dim_x, dim_y);
-        for (const auto & soldier : soldiers) {
-            Position other_pos = soldier.second->getPosition();
-            if (_position.collides(other_pos)) {
-                collides = true;
-                break;
-            }
-        }
-    } while (collides);
-    Position _position(x_pos, y_pos, getWidth(), getHeight(), dim_x, dim_y);
-    setPosition(std::move(_position));
+void Soldier::setRandomPosition(SpawnPlacer &placer,
+        const std::map<uint32_t, std::shared_ptr<Soldier>> &soldiers, double mass_center, double dim_x, double dim_y) {
+    setPosition(placer.place(soldiers, mass_center, SOLDIER_SPAWN_RANGE, getWidth(), getHeight(), dim_x, dim_y));
 }
\ No newline at end of file
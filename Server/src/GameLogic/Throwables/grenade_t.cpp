@@ -1,4 +1,5 @@
 #include "../../../include/GameLogic/Throwables/grenade_t.h"
+#include "../../../include/GameLogic/vec2.h"
 
 Grenade_t::Grenade_t(uint32_t throwable_id,
     double x, double y, double speed, double scope, double duration, 
@@ -49,9 +50,10 @@ uint8_t Grenade_t::getAction() {
 void Grenade_t::simulateExplosion(std::map<uint32_t, std::shared_ptr<Zombie>>& zombies) {
     RadialHitbox explodezone(position.getXPos(), position.getYPos(), scope);
     for (auto i = zombies.begin(); i != zombies.end(); i++) {
-        Position other_pos = i->second->getPosition();
+        const Position &other_pos = i->second->seePosition();
         if (explodezone.hits(other_pos)) {
-            double distance = std::sqrt(std::pow(std::abs(position.getXPos() - other_pos.getXPos()), 2) + std::pow(std::abs(position.getYPos() - other_pos.getYPos()), 2));
+            // la raiz solo para los que estan dentro del radio
+            double distance = delta(position, other_pos).length();
             i->second->recvDamage(ON, damage / distance, thrower_id);
         }
     }
@@ -31,7 +31,7 @@ void Poison::simulateThrow(
     Position next_pos(x_coord, position.getYPos(), scope, scope, dim_x, dim_y);
 
     for (auto i = soldiers.begin(); i != soldiers.end(); i++) {
-        Position other_pos = i->second->getPosition();
+        const Position &other_pos = i->second->getPosition();
         if (next_pos.collides(other_pos)) {
             i->second->recvDamage(ON, damage);
         }
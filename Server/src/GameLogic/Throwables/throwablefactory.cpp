@@ -15,6 +15,7 @@ std::shared_ptr<Throwable> ThrowableFactory::create(uint32_t *throwable_id,
     using YAML::LoadFile;
     using YAML::Node;
 
+    std::lock_guard<std::mutex> lock(mtx);
     Node node;
     double damage, scope, duration, speed;
     *throwable_id = code_counter;
@@ -34,31 +34,15 @@ bool P90Weapon::shoot(
     }
 
     double max_distance = bullet_speed * time;
-    double distance = max_distance; // distancia maxima
-    uint32_t victim_id;
-    double new_distance;
-    bool collision = false;
 
-    // verifico las colisiones.
-    for (auto i = zombies.begin(); i != zombies.end(); i++) {
-        Position victim_pos = i->second->getPosition();
-        if (hitbox.shoot_hits(victim_pos) && !(i->second->dying)) {
-            if (dir == RIGHT) {
-                new_distance = std::abs(victim_pos.getXPos() - from.getXPos());
-            } else if (dir == LEFT) {
-                new_distance = std::abs(from.getXPos() - victim_pos.getXPos());
-            }
-            if (distance > new_distance) {
-                distance = new_distance;
-                victim_id = i->first;
-            // me tengo que quedar con el más cercano
-            }
-            collision = true;
-        }
-    }
-    if (collision) {
+    // solo le pega al mas cercano
+    HitScan::Hits hits;
+    size_t found = getHitScan(zombies).scan(hitbox.getXMin(), hitbox.getXMax(),
+        hitbox.getYMin(), hitbox.getYMax(), from.getXPos(), 1, hits);
+    if (found > 0) {
+        double distance = hits[0].distance;
         double actual_damage = damage * (1.0 - ((max_distance - distance) / max_distance));
-        (zombies.at(victim_id))->recvDamage(ON, actual_damage, soldier_id);
+        (zombies.at(hits[0].id))->recvDamage(ON, actual_damage, soldier_id);
     }
     // resto balas/rafagas
     actual_ammo -= 1;
@@ -0,0 +1,11 @@
+#include "../../../include/GameLogic/Weapons/weapon.h"
+
+const HitScan& Weapon::getHitScan(const std::map<uint32_t, std::shared_ptr<Zombie>>& zombies) {
+    if (shared_scan != nullptr) return *shared_scan;
+    own_scan.load(zombies);
+    return own_scan;
+}
+
+void Weapon::useHitScan(const HitScan* scan) {
+    shared_scan = scan;
+}
@@ -112,7 +112,7 @@ void Venom::simulateMove(std::chrono::_V2::system_clock::time_point real_time,
 
         std::shared_ptr<Zombie> &witch = zombies.at(id);
         RadialHitbox hit_zone(position.getXPos(), position.getYPos(), hit_scope);
-        if (hit_zone.hits(witch->getPosition())) {
+        if (hit_zone.hits(witchPosition(witch))) {
             move(OFF, direction);
             return;
         }
@@ -2,7 +2,10 @@
 #include "../../../include/GameLogic/Soldiers/soldier.h"
 #include "../../../include/GameLogic/Throwables/throwablesfactory.h"
 #include "../../../include/GameLogic/Throwables/throwable.h"
-#define SPAWNRANGE 1000
+#include "../../../include/GameLogic/damagebuffer.h"
+#include "../../../include/GameLogic/vec2.h"
+#include "../../../include/GameLogic/perception.h"
+#define ZOMBIE_SPAWN_RANGE 2000
 
 /* CONSTRUCTOR */
 
@@ -106,6 +109,10 @@ void Zombie::idle(uint8_t state) {
 void Zombie::recvDamage(uint8_t state, double damage, uint32_t attacker) {
     switch(state) {
         case ON:
+            if (damage_buffer != nullptr) {
+                damage_buffer->toZombie(zombie_id, damage, attacker);
+                break;
+            }
             moving = attacking = screaming = false;
             being_hurt = true;
             damage_recv = damage;
@@ -118,6 +125,23 @@ void Zombie::recvDamage(uint8_t state, double damage, uint32_t attacker) {
 }
 
 
+bool Zombie::applyDamage(std::chrono::_V2::system_clock::time_point real_time,
+    double damage, uint32_t attacker) {
+    if (dying || !alive) return false;
+    moving = attacking = screaming = false;
+    attacker_id = attacker;
+    if (damage < actual_health) {
+        actual_health -= damage;
+        // queda herido un tick para la animacion, el daño ya esta aplicado
+        being_hurt = true;
+        damage_recv = 0.0;
+        return false;
+    }
+    death_time = real_time;
+    die(ON);
+    return true;
+}
+
 /* SIMULADORES */
 
 void Zombie::simulate(std::chrono::_V2::system_clock::time_point real_time,
@@ -173,20 +197,23 @@ void Zombie::detect_victim(
     double dim_x, 
     double dim_y) {
 
-    RadialHitbox sight_zone(position.getXPos(), position.getYPos(), sight);
+    // si el match ya hizo la pasada de percepcion uso el resultado cacheado
+    if (perceived) {
+        if (sees_victim && soldiers.count(seen_victim_id) > 0) {
+            *victim = seen_victim_id;
+            *detected = true;
+        }
+        return;
+    }
 
-    // verifico las colisiones.
-    double distance = std::sqrt(std::pow(dim_x, 2) + std::pow(dim_y, 2)); // distancia maxima
-    double new_distance;
+    // me tengo que quedar con el más cercano, comparo distancias al cuadrado
+    double distance = sight * sight;
     for (auto i = soldiers.begin(); i != soldiers.end(); i++) {
-        Position other_pos = i->second->getPosition();
-        if (sight_zone.hits(other_pos) && !(i->second->isDying()) && !(i->second->isDead())) {
-            new_distance = std::sqrt(std::pow(std::abs(position.getXPos() - other_pos.getXPos()), 2) + std::pow(std::abs(position.getYPos() - other_pos.getYPos()), 2));
-            if (distance > new_distance) {
-                distance = new_distance;
-                // me tengo que quedar con el más cercano
-                *victim = i->first;
-            }
+        if (i->second->isDying() || i->second->isDead()) continue;
+        double new_distance = distanceSq(position, i->second->seePosition());
+        if (new_distance <= distance) {
+            distance = new_distance;
+            *victim = i->first;
             *detected = true;
         }
     }
@@ -200,20 +227,21 @@ void Zombie::detect_screaming_witch(
     double dim_x, 
     double dim_y) {
 
-    RadialHitbox listening_zone(position.getXPos(), position.getYPos(), listening_range);
+    if (perceived) {
+        if (hears_witch && zombies.count(heard_witch_id) > 0) {
+            *witch_id = heard_witch_id;
+            *detected = true;
+        }
+        return;
+    }
 
-    // verifico las colisiones.
-    double distance = std::sqrt(std::pow(dim_x, 2) + std::pow(dim_y, 2)); // distancia maxima
-    double new_distance;
+    double distance = listening_range * listening_range;
     for (auto i = zombies.begin(); i != zombies.end(); i++) {
-        Position other_pos = i->second->getPosition();
-        if (listening_zone.hits(other_pos) && (i->second->screaming)) {
-            new_distance = std::sqrt(std::pow(std::abs(position.getXPos() - other_pos.getXPos()), 2) + std::pow(std::abs(position.getYPos() - other_pos.getYPos()), 2));
-            if (distance > new_distance) {
-                distance = new_distance;
-                // me tengo que quedar con el más cercano
-                *witch_id = i->first;
-            }
+        if (!i->second->screaming || i->first == zombie_id) continue;
+        double new_distance = distanceSq(position, i->second->seePosition());
+        if (new_distance <= distance) {
+            distance = new_distance;
+            *witch_id = i->first;
             *detected = true;
         }
     }
@@ -228,25 +256,19 @@ bool Zombie::CalculateNextPos_by_victim(double *next_x, double *next_y,
     } else {
         return false;
     }
-    double target_x = victim->getPosition().getXPos();
-    double target_y = victim->getPosition().getYPos();
-    double x = position.getXPos();
-    double y = position.getYPos();
-    if (target_x - x < 0) {
-        target_x += victim->getWidth();
+    // hacia donde esta la victima, por el lado mas corto del mapa
+    Vec2 move = delta(position, victim->seePosition());
+    if (move.x < 0) {
+        move.x += victim->getWidth();
         *direction = LEFT;
     } else {
         *direction = RIGHT;
-        target_y += victim->getWidth();
+        move.y += victim->getWidth();
     }
-    if (target_y - y < 0) {
-        target_y += victim->getHeight();
-    } else {
-        target_y += victim->getHeight();
-    }
-    double norma = std::sqrt(std::pow(std::abs(target_x - x), 2) + std::pow(std::abs(target_y - y), 2));
-    *next_x = ((target_x - x) / norma) * time * actual_speed + x;
-    *next_y = ((target_y - y) / norma) * time * actual_speed + y;
+    move.y += victim->getHeight();
+    steer(&move.x, &move.y);
+    *next_x = move.x * time * actual_speed + position.getXPos();
+    *next_y = move.y * time * actual_speed + position.getYPos();
     return true;
 }
 
@@ -259,28 +281,48 @@ bool Zombie::CalculateNextPos_by_witch(double *next_x, double *next_y,
     } else {
         return false;
     }
-    double target_x = witch->getPosition().getXPos();
-    double target_y = witch->getPosition().getYPos();
-    double x = position.getXPos();
-    double y = position.getYPos();
-    if (target_x - x < 0) {
-        target_x += witch->getWidth();
+    Vec2 move = delta(position, witchPosition(witch));
+    if (move.x < 0) {
+        move.x += witch->getWidth();
         *direction = LEFT;
     } else {
         *direction = RIGHT;
-        target_y += witch->getWidth();
+        move.y += witch->getWidth();
     }
-    if (target_y - y < 0) {
-        target_y += witch->getHeight();
-    } else {
-        target_y += witch->getHeight();
-    }
-    double norma = std::sqrt(std::pow(std::abs(target_x - x), 2) + std::pow(std::abs(target_y - y), 2));
-    *next_x = ((target_x - x) / norma) * time * actual_speed + x;
-    *next_y = ((target_y - y) / norma) * time * actual_speed + y;
+    move.y += witch->getHeight();
+    steer(&move.x, &move.y);
+    *next_x = move.x * time * actual_speed + position.getXPos();
+    *next_y = move.y * time * actual_speed + position.getYPos();
     return true;
 }
 
+Position Zombie::witchPosition(const std::shared_ptr<Zombie>& witch) {
+    if (perceived && hears_witch && heard_witch_id == witch->zombie_id) {
+        return Position(heard_witch_x, heard_witch_y, witch->width, witch->height, position.dim_x, position.dim_y);
+    }
+    return witch->getPosition();
+}
+
+bool Zombie::collidesWithZombies(const Position& next_pos,
+    std::map<uint32_t, std::shared_ptr<Zombie>>& zombies, bool count_dying) {
+    if (perceived && perception) return perception->blocked(zombie_id, next_pos, count_dying);
+    for (auto i = zombies.begin(); i != zombies.end(); i++) {
+        if (i->second->getId() == zombie_id) continue;
+        if (!count_dying && (i->second->isDying() || i->second->isDead())) continue;
+        if (next_pos.collides(i->second->getPosition())) return true;
+    }
+    return false;
+}
+
+void Zombie::steer(double *move_x, double *move_y) {
+    Vec2 move{*move_x, *move_y};
+    move = (perceived && flow_valid) ? Vec2{flow_x, flow_y} : move.normalized();
+    if (perceived) move += Vec2{separation_x, separation_y};
+    move = move.clamped(1.0);
+    *move_x = move.x;
+    *move_y = move.y;
+}
+
 void Zombie::simulateMove(std::chrono::_V2::system_clock::time_point real_time,
     std::map<uint32_t, std::shared_ptr<Soldier>>& soldiers,
     std::map<uint32_t, std::shared_ptr<Zombie>>& zombies, 
@@ -304,17 +346,11 @@ void Zombie::simulateMove(std::chrono::_V2::system_clock::time_point real_time,
             attack(ON, victim);
             return;
         }
+        // la separacion solo orienta, si igual choca con otro zombie no avanza
         Position next_pos(next_x, next_y, width, height, dim_x, dim_y);
+        if (collidesWithZombies(next_pos, zombies, false)) return;
         attack(OFF, nullptr);
         move(ON, direction);
-        for (auto i = zombies.begin(); i != zombies.end(); i++) {
-            Position &other_pos = i->second->getPosition();
-            if (i->second->getId() == zombie_id) continue;
-            if (i->second->isDying() || i->second->isDead()) continue;
-            if (next_pos.collides(other_pos)) {
-                return;
-            }
-        }
         position = next_pos;
         return;
     }
@@ -328,22 +364,17 @@ void Zombie::simulateMove(std::chrono::_V2::system_clock::time_point real_time,
 
         std::shared_ptr<Zombie> &witch = zombies.at(id);
         RadialHitbox hit_zone(position.getXPos(), position.getYPos(), hit_scope);
-        if (hit_zone.hits(witch->getPosition())) {
+        if (hit_zone.hits(witchPosition(witch))) {
             move(OFF, direction);
             idle(ON);
             return;
         }
         Position next_pos(next_x, next_y, width, height, dim_x, dim_y);
-        move(ON, direction);
-
-        for (auto i = zombies.begin(); i != zombies.end(); i++) {
-            Position other_pos = i->second->getPosition();
-            if (i->second->getId() == zombie_id) continue;
-            if (next_pos.collides(other_pos)) {
-                move(OFF, direction);
-                return;
-            }
+        if (collidesWithZombies(next_pos, zombies, true)) {
+            move(OFF, direction);
+            return;
         }
+        move(ON, direction);
         position = next_pos;
         return;
     }
@@ -428,35 +459,7 @@ uint8_t Zombie::isDeadFeedback(void) {
     return ALIVE;
 }
 
-void Zombie::setRandomPosition(
-        const std::map<uint32_t, std::shared_ptr<Soldier>> &soldiers,
-        const std::map<uint32_t, std::shared_ptr<Zombie>> &zombies, double dim_x, double dim_y, double mass_center) {
-    using std::random_device;
-    using std::mt19937;
-    using std::uniform_int_distribution;
-    using std::uint32_t;
-
-    random_device rd;
-    mt19937 mt(rd());
-    //uniform_int_distribution<int32_t> distx(dim_x * 0.45, dim_x * 0.45 + SPAWNRANGE);
-    uniform_int_distribution<int32_t> distx(mass_center - 2000, mass_center + 2000);
-    uniform_int_distribution<int32_t> disty(0, dim_y);
-    int32_t x_pos;
-    int32_t y_pos;
-    bool collides;
-    do {
-        collides = false;
-        x_pos = distx(mt);
-        y_pos = disty(mt);
-        Position _position(x_pos, y_pos, getWidth(), getHeight(), dim_x, dim_y);
-        for (auto i = soldiers.begin(); i != soldiers.end(); i++) {
-            Position other_pos = i->second->getPosition();
-            if (position.collides(other_pos)) {
-                collides = true;
-                break;
-            }
-        }
-    } while (collides);
-    Position _position(x_pos, y_pos, getWidth(), getHeight(), dim_x, dim_y);
-    setPosition(std::move(_position));
+void Zombie::setRandomPosition(SpawnPlacer &placer,
+        const std::map<uint32_t, std::shared_ptr<Soldier>> &soldiers, double dim_x, double dim_y, double mass_center) {
+    setPosition(placer.place(soldiers, mass_center, ZOMBIE_SPAWN_RANGE, getWidth(), getHeight(), dim_x, dim_y));
 }
@@ -6,18 +6,20 @@ ClearTheZone::ClearTheZone(double x_dimension, double y_dimension, uint8_t diffi
 }
 
 void ClearTheZone::simulateStep(std::chrono::_V2::system_clock::time_point real_time) {
-    for (auto & zombie : zombies) {
-        zombie.second->simulate(real_time, std::ref(soldiers), std::ref(zombies), std::ref(throwables), x_dim, y_dim, t_factory);
-    }
+    simulateZombies(real_time);
     delete_dead_zombies();
 
     for (auto & throwable : throwables) {
         throwable.second->simulateThrow(real_time, std::ref(soldiers), std::ref(zombies), x_dim, y_dim);
     }
     // delete_inactive_throwables();
+    // posiciones de este tick para todos los disparos
+    hit_scan.load(zombies);
     for (auto & soldier : soldiers) {
         soldier.second->simulate(real_time, std::ref(soldiers), std::ref(zombies), std::ref(throwables), x_dim, y_dim, t_factory, calculate_mass_center());
     }
+    // todo el daño del tick junto, no importa el orden en que se simularon
+    damage_buffer.resolve(real_time, soldiers, zombies);
     delete_dead_soldiers();
 
     if ((dead_zombies_counter == zombie_counter) && finalizable) winMatch();
@@ -34,5 +36,6 @@ void ClearTheZone::loseMatch(void) {
 
 void ClearTheZone::configurate(uint8_t difficulty) {
     MatchConfigurator configurator;
-    configurator.configurate(CLEAR_THE_ZONE, difficulty, zombies, soldiers, x_dim, y_dim, &code_counter, &zombie_counter, calculate_mass_center());
+    configurator.configurate(CLEAR_THE_ZONE, difficulty, zombies, soldiers, x_dim, y_dim, &code_counter, &zombie_counter, calculate_mass_center(), spawner);
+    attachDamageBuffer();
 }
\ No newline at end of file
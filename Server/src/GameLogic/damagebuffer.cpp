@@ -0,0 +1,92 @@
+#include "../../include/GameLogic/damagebuffer.h"
+#include "../../include/GameLogic/Soldiers/soldier.h"
+#include "../../include/GameLogic/Zombies/zombie.h"
+
+#include <algorithm>
+
+static bool compareEvents(const DamageBuffer::Event& a, const DamageBuffer::Event& b) {
+    if (a.target != b.target) return a.target < b.target;
+    return a.attacker < b.attacker;
+}
+
+static thread_local size_t current_lane = 0;
+
+void DamageBuffer::setLanes(size_t lanes) {
+    if (lanes == 0) lanes = 1;
+    zombie_lanes.resize(lanes);
+    soldier_lanes.resize(lanes);
+}
+
+void DamageBuffer::setCurrentLane(size_t lane) {
+    current_lane = lane;
+}
+
+void DamageBuffer::toZombie(uint32_t zombie_id, double damage, uint32_t attacker_id) {
+    size_t lane = (current_lane < zombie_lanes.size()) ? current_lane : 0;
+    zombie_lanes[lane].push_back({zombie_id, attacker_id, damage});
+}
+
+void DamageBuffer::toSoldier(uint32_t soldier_id, double damage) {
+    size_t lane = (current_lane < soldier_lanes.size()) ? current_lane : 0;
+    soldier_lanes[lane].push_back({soldier_id, 0, damage});
+}
+
+void DamageBuffer::resolve(std::chrono::_V2::system_clock::time_point real_time,
+    std::map<uint32_t, std::shared_ptr<Soldier>>& soldiers,
+    std::map<uint32_t, std::shared_ptr<Zombie>>& zombies) {
+    for (auto & lane : zombie_lanes) {
+        zombie_events.insert(zombie_events.end(), lane.begin(), lane.end());
+        lane.clear();
+    }
+    for (auto & lane : soldier_lanes) {
+        soldier_events.insert(soldier_events.end(), lane.begin(), lane.end());
+        lane.clear();
+    }
+
+    // ordeno por objetivo y atacante, asi cada objetivo queda contiguo
+    std::sort(zombie_events.begin(), zombie_events.end(), compareEvents);
+    for (size_t i = 0; i < zombie_events.size();) {
+        uint32_t target = zombie_events[i].target;
+        double total = 0;
+        double best_damage = 0;
+        uint32_t killer = zombie_events[i].attacker;
+        while (i < zombie_events.size() && zombie_events[i].target == target) {
+            // sumo lo de cada atacante para saber quien hizo mas daño
+            uint32_t attacker = zombie_events[i].attacker;
+            double by_attacker = 0;
+            while (i < zombie_events.size() && zombie_events[i].target == target
+                && zombie_events[i].attacker == attacker) {
+                by_attacker += zombie_events[i].damage;
+                i++;
+            }
+            total += by_attacker;
+            if (by_attacker > best_damage) { best_damage = by_attacker; killer = attacker; }
+        }
+        auto zombie = zombies.find(target);
+        if (zombie == zombies.end()) continue;
+        if (zombie->second->applyDamage(real_time, total, killer) && soldiers.count(killer) > 0) {
+            soldiers.at(killer)->increase_kill_counter();
+        }
+    }
+    zombie_events.clear();
+
+    std::sort(soldier_events.begin(), soldier_events.end(), compareEvents);
+    for (size_t i = 0; i < soldier_events.size();) {
+        uint32_t target = soldier_events[i].target;
+        double total = 0;
+        while (i < soldier_events.size() && soldier_events[i].target == target) {
+            total += soldier_events[i].damage;
+            i++;
+        }
+        auto soldier = soldiers.find(target);
+        if (soldier == soldiers.end()) continue;
+        soldier->second->applyDamage(real_time, total);
+    }
+    soldier_events.clear();
+}
+
+bool DamageBuffer::empty(void) const {
+    for (auto & lane : zombie_lanes) if (!lane.empty()) return false;
+    for (auto & lane : soldier_lanes) if (!lane.empty()) return false;
+    return true;
+}
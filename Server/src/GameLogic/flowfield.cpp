@@ -0,0 +1,98 @@
+#include "../../include/GameLogic/flowfield.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+constexpr uint16_t UNREACHED = std::numeric_limits<uint16_t>::max();
+constexpr double DIAGONAL = 0.70710678118654752; // 1 / sqrt(2)
+
+void FlowField::resize(double dim_x, double dim_y, double new_cell_size) {
+    cell_size = (new_cell_size > 0) ? new_cell_size : 1;
+    cells_x = static_cast<int32_t>(dim_x / cell_size) + 1;
+    cells_y = static_cast<int32_t>(dim_y / cell_size) + 1;
+    distances.assign(cells_x * cells_y, UNREACHED);
+    frontier.reserve(cells_x * cells_y);
+}
+
+void FlowField::clear(void) {
+    std::fill(distances.begin(), distances.end(), UNREACHED);
+    frontier.clear();
+    seeded = false;
+}
+
+void FlowField::addSeed(double x, double y) {
+    if (distances.empty()) return;
+    uint32_t cell = cellY(y) * cells_x + cellX(x);
+    if (distances[cell] == 0) return;
+    distances[cell] = 0;
+    frontier.push_back(cell);
+    seeded = true;
+}
+
+void FlowField::build(void) {
+    // BFS: frontier funciona como cola, head avanza sobre lo ya expandido
+    for (size_t head = 0; head < frontier.size(); head++) {
+        int32_t cx = frontier[head] % cells_x;
+        int32_t cy = frontier[head] / cells_x;
+        uint16_t next = distances[frontier[head]] + 1;
+        const int32_t neighbours[4][2] = {{cx - 1, cy}, {cx + 1, cy}, {cx, cy - 1}, {cx, cy + 1}};
+        for (auto & n : neighbours) {
+            if (n[1] < 0 || n[1] >= cells_y) continue;
+            int32_t nx = (n[0] + cells_x) % cells_x; // el mapa es circular en x
+            uint32_t cell = n[1] * cells_x + nx;
+            if (distances[cell] != UNREACHED) continue;
+            distances[cell] = next;
+            frontier.push_back(cell);
+        }
+    }
+}
+
+bool FlowField::empty(void) const {
+    return !seeded;
+}
+
+bool FlowField::direction(double x, double y, double *dir_x, double *dir_y) const {
+    if (!seeded) return false;
+    int32_t cx = cellX(x);
+    int32_t cy = cellY(y);
+    uint16_t best = distanceAt(cx, cy);
+    if (best == 0) return false;
+
+    int32_t best_dx = 0;
+    int32_t best_dy = 0;
+    for (int32_t dy = -1; dy <= 1; dy++) {
+        for (int32_t dx = -1; dx <= 1; dx++) {
+            if (dx == 0 && dy == 0) continue;
+            uint16_t distance = distanceAt(cx + dx, cy + dy);
+            if (distance < best) {
+                best = distance;
+                best_dx = dx;
+                best_dy = dy;
+            }
+        }
+    }
+    if (best_dx == 0 && best_dy == 0) return false;
+    double scale = (best_dx != 0 && best_dy != 0) ? DIAGONAL : 1.0;
+    *dir_x = best_dx * scale;
+    *dir_y = best_dy * scale;
+    return true;
+}
+
+int32_t FlowField::cellX(double x) const {
+    int32_t cx = static_cast<int32_t>(std::floor(x / cell_size)) % cells_x;
+    return (cx < 0) ? cx + cells_x : cx;
+}
+
+int32_t FlowField::cellY(double y) const {
+    int32_t cy = static_cast<int32_t>(std::floor(y / cell_size));
+    if (cy < 0) return 0;
+    if (cy >= cells_y) return cells_y - 1;
+    return cy;
+}
+
+uint16_t FlowField::distanceAt(int32_t cx, int32_t cy) const {
+    if (cy < 0 || cy >= cells_y) return UNREACHED;
+    cx = (cx + cells_x) % cells_x;
+    return distances[cy * cells_x + cx];
+}
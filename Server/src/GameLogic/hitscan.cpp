@@ -0,0 +1,55 @@
+#include "../../include/GameLogic/hitscan.h"
+#include "../../include/GameLogic/Zombies/zombie.h"
+
+#include <cmath>
+
+void HitScan::load(const std::map<uint32_t, std::shared_ptr<Zombie>>& zombies) {
+    xs.clear();
+    ys.clear();
+    ids.clear();
+    for (auto & zombie : zombies) {
+        if (zombie.second->dying) continue;
+        const Position &pos = zombie.second->seePosition();
+        xs.push_back(pos.getXPos());
+        ys.push_back(pos.getYPos());
+        ids.push_back(zombie.first);
+    }
+    candidates.resize(ids.size());
+}
+
+size_t HitScan::scan(double x_min, double x_max, double y_min, double y_max,
+    double from_x, size_t max_hits, Hits& hits) const {
+    if (max_hits > MAX_HITS) max_hits = MAX_HITS;
+    if (max_hits == 0) return 0;
+
+    // filtro sin saltos: siempre escribo el indice y avanzo solo si esta adentro,
+    // asi el compilador puede vectorizar las comparaciones
+    const size_t total = xs.size();
+    const double *x = xs.data();
+    const double *y = ys.data();
+    uint32_t *out = candidates.data();
+    size_t count = 0;
+    for (size_t i = 0; i < total; i++) {
+        out[count] = static_cast<uint32_t>(i);
+        count += (x[i] >= x_min) & (x[i] <= x_max) & (y[i] >= y_min) & (y[i] <= y_max);
+    }
+
+    // me quedo con los max_hits mas cercanos con insercion ordenada
+    size_t found = 0;
+    for (size_t c = 0; c < count; c++) {
+        uint32_t index = out[c];
+        double distance = std::abs(x[index] - from_x);
+        if (found == max_hits && distance >= hits[found - 1].distance) continue;
+        size_t pos = (found < max_hits) ? found++ : found - 1;
+        while (pos > 0 && hits[pos - 1].distance > distance) {
+            hits[pos] = hits[pos - 1];
+            pos--;
+        }
+        hits[pos] = Hit{distance, ids[index]};
+    }
+    return found;
+}
+
+size_t HitScan::size(void) const {
+    return ids.size();
+}
@@ -1,4 +1,7 @@
 #include "../../include/GameLogic/match.h"
+#include "../../include/GameLogic/vec2.h"
+#include <iterator>
+#include <limits>
 #include "yaml-cpp/yaml.h"
 
 Match::Match(double x_dimension, double y_dimension, uint32_t code) :
@@ -9,18 +12,84 @@ Match::Match(double x_dimension, double y_dimension, uint32_t code) :
     code(code),
     configurator(),
     t_factory(std::ref(code_counter)) {
+    YAML::Node config = YAML::LoadFile(SERVER_CONFIG_PATH "/config.yaml");
+    YAML::Node interest = config["interest"];
+    interest_margin = interest["margin"].as<int32_t>();
+    view_hint_margin = interest["view_hint_margin"].as<int32_t>();
+    YAML::Node ai_lod = config["ai_lod"];
+    perception.setLevelOfDetail(ai_lod["near_distance"].as<double>(), ai_lod["far_slices"].as<uint32_t>());
+    YAML::Node flow = config["flow"];
+    perception.setFlowField(x_dim, y_dim, flow["cell_size"].as<double>());
+    perception.setSeparation(flow["separation_radius"].as<double>(), flow["separation_weight"].as<double>());
+    YAML::Node parallel = config["parallel"];
+    int32_t workers = parallel["workers"].as<int32_t>();
+    if (workers < 0) workers = std::max<int32_t>(0, static_cast<int32_t>(std::thread::hardware_concurrency()) - 1);
+    setParallelism(workers, parallel["min_zombies"].as<size_t>(), parallel["chunk"].as<size_t>());
+    spawner.seed(config["spawn"]["seed"].as<uint32_t>());
+}
+
+void Match::setParallelism(size_t workers, size_t min_zombies, size_t chunk) {
+    zombie_workers = workers;
+    parallel_min_zombies = min_zombies;
+    zombies_per_chunk = (chunk == 0) ? 1 : chunk;
+    zombie_pool.reset();
+    damage_buffer.setLanes(workers + 1);
+    pending_throwables.resize(workers + 1);
+}
+
+void Match::simulateZombies(std::chrono::_V2::system_clock::time_point real_time) {
+    perception.update(soldiers, zombies);
+    active_zombies.clear();
+    for (auto & zombie : zombies) {
+        // los lejanos acumulan el dt desde su ultimo paso (last_step_time)
+        if (perception.shouldSimulate(*zombie.second)) active_zombies.push_back(zombie.second.get());
+    }
+
+    if (zombie_workers == 0 || active_zombies.size() < parallel_min_zombies) {
+        for (Zombie* zombie : active_zombies) {
+            zombie->simulate(real_time, std::ref(soldiers), std::ref(zombies), std::ref(throwables), x_dim, y_dim, t_factory);
+        }
+        return;
+    }
+
+    // el pool se crea recien cuando hace falta, las partidas chicas no levantan hilos
+    if (!zombie_pool) zombie_pool.reset(new WorkerPool(zombie_workers));
+    // cada zombie solo escribe su propio estado; el daño va al carril del hilo
+    // y el veneno a pending_throwables[lane]
+    zombie_pool->parallelFor(active_zombies.size(), zombies_per_chunk,
+        [this, real_time](size_t begin, size_t end, size_t lane) {
+            DamageBuffer::setCurrentLane(lane);
+            for (size_t i = begin; i < end; i++) {
+                active_zombies[i]->simulate(real_time, std::ref(soldiers), std::ref(zombies),
+                    std::ref(pending_throwables[lane]), x_dim, y_dim, t_factory);
+            }
+            DamageBuffer::setCurrentLane(0);
+        });
+    for (auto & pending : pending_throwables) {
+        throwables.insert(pending.begin(), pending.end());
+        pending.clear();
+    }
+}
+
+void Match::attachDamageBuffer(void) {
+    for (auto & soldier : soldiers) soldier.second->damage_buffer = &damage_buffer;
+    for (auto & zombie : zombies) zombie.second->damage_buffer = &damage_buffer;
 }
 
 void Match::delete_soldier(uint32_t soldier_id) {
     if (soldiers.count(soldier_id)>0) {
         soldiers.erase(soldier_id);
     }
+    forgetPlayer(soldier_id);
 }
 
 void Match::join(uint32_t soldier_id, uint8_t soldier_type) {
     SoldierFactory factory;
     std::shared_ptr<Soldier> soldier = factory.create(soldier_id, soldier_type);
-    soldier->setRandomPosition(std::ref(soldiers), std::ref(zombies), calculate_mass_center(), x_dim, y_dim);
+    spawner.reset();
+    soldier->setRandomPosition(spawner, soldiers, calculate_mass_center(), x_dim, y_dim);
+    soldier->weapon->useHitScan(&hit_scan);
+    soldier->damage_buffer = &damage_buffer;
     soldiers.emplace(soldier_id, std::move(soldier));
     soldier_counter += 1;
     finalizable = true;
@@ -29,7 +98,9 @@ void Match::join(uint32_t soldier_id, uint8_t soldier_type) {
 void Match::setZombie(uint32_t zombie_id, uint8_t zombie_type) {
     ZombieFactory factory;
     std::shared_ptr<Zombie> zombie = factory.create(zombie_id, zombie_type);
-    zombie->setRandomPosition(std::ref(soldiers), std::ref(zombies), x_dim, y_dim, calculate_mass_center());
+    spawner.reset();
+    zombie->setRandomPosition(spawner, soldiers, x_dim, y_dim, calculate_mass_center());
+    zombie->damage_buffer = &damage_buffer;
     zombies.emplace(zombie_id, std::move(zombie));
     zombie_counter += 1;
 }
@@ -152,12 +223,21 @@ void Match::delete_inactive_throwables(void) {
 }
 
 std::vector<std::pair<uint16_t, ElementStateDTO >> Match::getElementStates() {
+    return collectElementStates(0, std::numeric_limits<double>::infinity());
+}
+
+// Los soldados se mandan siempre (el cliente centra la camara con ellos),
+// zombies y throwables solo si estan cerca del centro, tambien del otro lado del borde.
+std::vector<std::pair<uint16_t, ElementStateDTO >> Match::collectElementStates(double center_x, double half_width) {
     std::vector<std::pair<uint16_t, ElementStateDTO>> elementStates;
+    double period = x_dim + 1.0;
     // valores para rellenar
     uint16_t null_16 = 0;
     uint8_t null_8 = 0;
 
     for (const auto & throwable : throwables) {
+        double throwable_x = throwable.second->getPosition().getXPos();
+        if (std::abs(wrapDelta(center_x, throwable_x, period)) > half_width) continue;
         int id = throwable.second->getId();
         uint8_t actor_type = throwable.second->getThrowerType();
         uint8_t actor_action = throwable.second->getAction();
@@ -190,6 +270,8 @@ std::vector<std::pair<uint16_t, ElementStateDTO >> Match::getElementStates() {
         elementStates.emplace_back(id, std::move(dto));
     }
     for (const auto & zombie : zombies) {
+        double zombie_x = zombie.second->getPosition().getXPos();
+        if (std::abs(wrapDelta(center_x, zombie_x, period)) > half_width) continue;
         int id = zombie.second->getId();
         uint8_t actor_type = zombie.second->getZombieType();
         uint8_t actor_action = zombie.second->getAction();
@@ -212,6 +294,47 @@ GameStateFeedback Match::getMatchState(void) {
     return GameStateFeedback(std::move(getElementStates()));
 }
 
+void Match::setViewHint(uint32_t soldier_id, int32_t window_x, uint16_t window_width) {
+    view_hints[soldier_id] = std::make_pair(window_x, window_width);
+}
+
+bool Match::hasViewHint(uint32_t soldier_id) {
+    return view_hints.count(soldier_id) > 0;
+}
+
+std::vector<std::pair<uint16_t, ElementStateDTO >> Match::getElementStates(uint32_t soldier_id) {
+    if (hasViewHint(soldier_id)) {
+        const std::pair<int32_t, uint16_t>& hint = view_hints.at(soldier_id);
+        double half_window = hint.second * 0.5;
+        return collectElementStates(hint.first + half_window, half_window + view_hint_margin);
+    }
+    return collectElementStates(calculate_mass_center(), interest_margin);
+}
+
+std::vector<uint16_t> Match::updateInterest(uint32_t soldier_id,
+    const std::vector<std::pair<uint16_t, ElementStateDTO >>& element_states) {
+    std::set<uint16_t>& previous = interest_sets[soldier_id];
+    std::set<uint16_t> current;
+    for (const auto & element : element_states) {
+        current.insert(element.first);
+    }
+    std::vector<uint16_t> left;
+    std::set_difference(previous.begin(), previous.end(),
+                        current.begin(), current.end(),
+                        std::back_inserter(left));
+    previous = std::move(current);
+    return left;
+}
+
+void Match::restoreInterest(uint32_t soldier_id, const std::vector<uint16_t>& left) {
+    interest_sets[soldier_id].insert(left.begin(), left.end());
+}
+
+void Match::forgetPlayer(uint32_t soldier_id) {
+    view_hints.erase(soldier_id);
+    interest_sets.erase(soldier_id);
+}
+
 std::vector<std::pair<uint16_t, ScoreDTO >> Match::getScores() {
     std::vector<std::pair<uint16_t, ScoreDTO>> scores;
     for (const auto & soldier : soldiers) {
@@ -9,12 +9,15 @@ MatchConfigurator::MatchConfigurator(void) {
 void MatchConfigurator::configurate(uint8_t mode, uint8_t difficulty,
     std::map<uint32_t, std::shared_ptr<Zombie>> &zombies,
     std::map<uint32_t, std::shared_ptr<Soldier>> &soldiers,
-    double dim_x, double dim_y, uint32_t *code_counter, uint16_t *zombie_counter, double mass_center) {
+    double dim_x, double dim_y, uint32_t *code_counter, uint16_t *zombie_counter, double mass_center,
+    SpawnPlacer &placer) {
 
     using YAML::LoadFile;
     using YAML::Node;
     Node config;
     ZombieFactory factory;
+    // toda la tanda se ubica sobre la misma grilla de lugares libres
+    placer.reset();
 
     switch (mode) {
     case SURVIVAL:
@@ -62,7 +65,7 @@ void MatchConfigurator::configurate(uint8_t mode, uint8_t difficulty,
     int end = begin + amount_infected;
     for (int i = begin; i < end; i++) {
         std::shared_ptr<Zombie> zombie = factory.create(i, ZOMBIE);
-        zombie->setRandomPosition(std::ref(soldiers), std::ref(zombies), dim_x, dim_y, mass_center);
+        zombie->setRandomPosition(placer, soldiers, dim_x, dim_y, mass_center);
         zombies.emplace(i, std::move(zombie));
         *zombie_counter += 1;
     }
@@ -70,7 +73,7 @@ void MatchConfigurator::configurate(uint8_t mode, uint8_t difficulty,
     end += amount_spear;
     for (int i = begin; i < end; i++) {
         std::shared_ptr<Zombie> zombie = factory.create(i, SPEAR);
-        zombie->setRandomPosition(std::ref(soldiers), std::ref(zombies), dim_x, dim_y, mass_center);
+        zombie->setRandomPosition(placer, soldiers, dim_x, dim_y, mass_center);
         zombies.emplace(i, std::move(zombie));
         *zombie_counter += 1;
     }
@@ -78,7 +81,7 @@ void MatchConfigurator::configurate(uint8_t mode, uint8_t difficulty,
     end += amount_jumper;
     for (int i = begin; i < end; i++) {
         std::shared_ptr<Zombie> zombie = factory.create(i, JUMPER);
-        zombie->setRandomPosition(std::ref(soldiers), std::ref(zombies), dim_x, dim_y, mass_center);
+        zombie->setRandomPosition(placer, soldiers, dim_x, dim_y, mass_center);
         zombies.emplace(i, std::move(zombie));
         *zombie_counter += 1;
     }
@@ -86,7 +89,7 @@ void MatchConfigurator::configurate(uint8_t mode, uint8_t difficulty,
     end += amount_venom;
     for (int i = begin; i < end; i++) {
         std::shared_ptr<Zombie> zombie = factory.create(i, VENOM);
-        zombie->setRandomPosition(std::ref(soldiers), std::ref(zombies), dim_x, dim_y, mass_center);
+        zombie->setRandomPosition(placer, soldiers, dim_x, dim_y, mass_center);
         zombies.emplace(i, std::move(zombie));
         *zombie_counter += 1;
     }
@@ -94,54 +97,9 @@ void MatchConfigurator::configurate(uint8_t mode, uint8_t difficulty,
     end += amount_witch;
     for (int i = begin; i < end; i++) {
         std::shared_ptr<Zombie> zombie = factory.create(i, WITCH);
-        zombie->setRandomPosition(std::ref(soldiers), std::ref(zombies), dim_x, dim_y, mass_center);
+        zombie->setRandomPosition(placer, soldiers, dim_x, dim_y, mass_center);
         zombies.emplace(i, std::move(zombie));
         *zombie_counter += 1;
     }
     *code_counter = end;
 }
-
-void MatchConfigurator::add_zombies(int amount,
-    std::map<uint32_t, std::shared_ptr<Zombie>> &zombies,
-    std::map<uint32_t, std::shared_ptr<Soldier>> &soldiers,
-    double dim_x, double dim_y, uint32_t *code_counter, uint16_t *zombie_counter, double mass_center) {
-
-    ZombieFactory factory;
-    begin = *code_counter;
-    uint32_t end = begin + amount;
-    for (uint32_t i = begin; i < end; i++) {
-        std::shared_ptr<Zombie> zombie = factory.create(i, ZOMBIE);
-        zombie->setRandomPosition(std::ref(soldiers), std::ref(zombies), dim_x, dim_y, mass_center);
-        zombies.emplace(i, std::move(zombie));
-    }
-    begin = end;
-    end += amount;
-    for (uint32_t i = begin; i < end; i++) {
-        std::shared_ptr<Zombie> zombie = factory.create(i, SPEAR);
-        zombie->setRandomPosition(std::ref(soldiers), std::ref(zombies), dim_x, dim_y, mass_center);
-        zombies.emplace(i, std::move(zombie));
-    }
-    begin = end;
-    end += amount;
-    for (uint32_t i = begin; i < end; i++) {
-        std::shared_ptr<Zombie> zombie = factory.create(i, JUMPER);
-        zombie->setRandomPosition(std::ref(soldiers), std::ref(zombies), dim_x, dim_y, mass_center);
-        zombies.emplace(i, std::move(zombie));
-    }
-    begin = end;
-    end += amount;
-    for (uint32_t i = begin; i < end; i++) {
-        std::shared_ptr<Zombie> zombie = factory.create(i, VENOM);
-        zombie->setRandomPosition(std::ref(soldiers), std::ref(zombies), dim_x, dim_y, mass_center);
-        zombies.emplace(i, std::move(zombie));
-    }
-    begin = end;
-    end += amount;
-    for (uint32_t i = begin; i < end; i++) {
-        std::shared_ptr<Zombie> zombie = factory.create(i, WITCH);
-        zombie->setRandomPosition(std::ref(soldiers), std::ref(zombies), dim_x, dim_y, mass_center);
-        zombies.emplace(i, std::move(zombie));
-    }
-    *code_counter = end;
-    *zombie_counter += amount * 5;
-}
\ No newline at end of file
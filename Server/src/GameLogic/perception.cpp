@@ -0,0 +1,208 @@
+#include "../../include/GameLogic/perception.h"
+#include "../../include/GameLogic/Soldiers/soldier.h"
+#include "../../include/GameLogic/Zombies/zombie.h"
+
+#include <algorithm>
+#include <limits>
+
+static bool compareByX(const Perception::Target& a, const Perception::Target& b) {
+    return a.x < b.x;
+}
+
+void Perception::setLevelOfDetail(double new_near_distance, uint32_t new_far_slices) {
+    near_distance = new_near_distance;
+    far_slices = (new_far_slices == 0) ? 1 : new_far_slices;
+}
+
+void Perception::setFlowField(double dim_x, double dim_y, double cell_size) {
+    period = (dim_x > 0) ? dim_x + 1.0 : std::numeric_limits<double>::infinity();
+    soldier_flow.resize(dim_x, dim_y, cell_size);
+    scream_flow.resize(dim_x, dim_y, cell_size);
+}
+
+void Perception::setSeparation(double radius, double weight) {
+    separation_radius = radius;
+    separation_weight = weight;
+}
+
+void Perception::update(const std::map<uint32_t, std::shared_ptr<Soldier>>& soldiers,
+    const std::map<uint32_t, std::shared_ptr<Zombie>>& zombies) {
+    live_soldiers.clear();
+    for (auto & soldier : soldiers) {
+        if (soldier.second->isDying() || soldier.second->isDead()) continue;
+        const Position &pos = soldier.second->getPosition();
+        live_soldiers.push_back({pos.getXPos(), pos.getYPos(), soldier.first});
+    }
+    std::sort(live_soldiers.begin(), live_soldiers.end(), compareByX);
+
+    screaming_witches.clear();
+    live_zombies.clear();
+    obstacles.clear();
+    max_half_width = 0;
+    for (auto & zombie : zombies) {
+        const Position &pos = zombie.second->seePosition();
+        obstacles.push_back({pos.getAabb(), zombie.first, zombie.second->dying || zombie.second->isDead()});
+        max_half_width = std::max(max_half_width, pos.half_width);
+        if (!zombie.second->dying && !zombie.second->isDead()) {
+            live_zombies.push_back({pos.getXPos(), pos.getYPos(), zombie.first});
+        }
+        if (!zombie.second->screaming) continue;
+        screaming_witches.push_back({pos.getXPos(), pos.getYPos(), zombie.first});
+    }
+    std::sort(screaming_witches.begin(), screaming_witches.end(), compareByX);
+    std::sort(live_zombies.begin(), live_zombies.end(), compareByX);
+    std::sort(obstacles.begin(), obstacles.end(),
+        [](const Obstacle& a, const Obstacle& b) { return a.box.x < b.box.x; });
+
+    soldier_flow.clear();
+    for (auto & soldier : live_soldiers) soldier_flow.addSeed(soldier.x, soldier.y);
+    soldier_flow.build();
+    scream_flow.clear();
+    for (auto & witch : screaming_witches) scream_flow.addSeed(witch.x, witch.y);
+    scream_flow.build();
+
+    tick++;
+    for (auto & zombie : zombies) {
+        Zombie &z = *zombie.second;
+        double x = z.seePosition().getXPos();
+        double y = z.seePosition().getYPos();
+        z.near_team = (near_distance <= 0) || (distanceToTeam(x) <= near_distance);
+        // los objetivos se refrescan siempre (es una busqueda binaria): un
+        // zombie postergado no se queda con una victima que ya no ve
+        Target found{0, 0, 0};
+        z.sees_victim = nearest(live_soldiers, x, y, z.sight, z.zombie_id, &found, period);
+        if (z.sees_victim) z.seen_victim_id = found.id;
+        // guardo donde estaba la witch: durante el tick otro hilo puede estar moviendola
+        z.hears_witch = nearest(screaming_witches, x, y, z.listening_range, z.zombie_id, &found, period);
+        if (z.hears_witch) {
+            z.heard_witch_id = found.id;
+            z.heard_witch_x = found.x;
+            z.heard_witch_y = found.y;
+        }
+        z.perceived = true;
+        z.perception = this;
+        // el flow y la separacion solo los usa el paso de movimiento
+        if (!shouldSimulate(z)) continue;
+
+        // la victima tiene prioridad sobre la witch, igual que en simulateMove
+        z.flow_valid = false;
+        if (z.sees_victim) {
+            z.flow_valid = soldier_flow.direction(x, y, &z.flow_x, &z.flow_y);
+        } else if (z.hears_witch) {
+            z.flow_valid = scream_flow.direction(x, y, &z.flow_x, &z.flow_y);
+        }
+        separation(z, &z.separation_x, &z.separation_y);
+    }
+}
+
+bool Perception::nearest(const std::vector<Target>& targets, double x, double y,
+    double range, uint32_t exclude_id, Target *found_target, double period) {
+    double best = range * range;
+    bool found = sweep(targets, x, y, exclude_id, &best, found_target);
+    // cerca de un borde los del otro lado quedan a x +- period
+    if (x - range < 0) found |= sweep(targets, x + period, y, exclude_id, &best, found_target);
+    if (x + range > period) found |= sweep(targets, x - period, y, exclude_id, &best, found_target);
+    return found;
+}
+
+bool Perception::blocked(uint32_t zombie_id, const Position& next_pos, bool count_dying) const {
+    double x = next_pos.getXPos();
+    double reach = next_pos.half_width + max_half_width;
+    if (blockedNear(zombie_id, next_pos, x, reach, count_dying)) return true;
+    // cerca de un borde tambien choca con los del otro lado
+    if (x - reach < 0 && blockedNear(zombie_id, next_pos, x + period, reach, count_dying)) return true;
+    if (x + reach > period && blockedNear(zombie_id, next_pos, x - period, reach, count_dying)) return true;
+    return false;
+}
+
+bool Perception::blockedNear(uint32_t zombie_id, const Position& next_pos, double x,
+    double reach, bool count_dying) const {
+    auto start = std::lower_bound(obstacles.begin(), obstacles.end(), x - reach,
+        [](const Obstacle& obstacle, double value) { return obstacle.box.x < value; });
+    for (auto i = start; i != obstacles.end() && i->box.x <= x + reach; i++) {
+        if (i->id == zombie_id) continue;
+        if (i->dying && !count_dying) continue;
+        uint8_t hit;
+        if (next_pos.collides(&i->box, 1, &hit) > 0) return true;
+    }
+    return false;
+}
+
+bool Perception::sweep(const std::vector<Target>& targets, double x, double y,
+    uint32_t exclude_id, double *best, Target *found_target) {
+    bool found = false;
+    auto start = std::lower_bound(targets.begin(), targets.end(), Target{x, y, 0}, compareByX);
+
+    // hacia la derecha, corto cuando la distancia en x ya supera al mejor
+    for (auto i = start; i != targets.end(); i++) {
+        double dx = i->x - x;
+        if (dx * dx > *best) break;
+        double dy = i->y - y;
+        double distance = dx * dx + dy * dy;
+        if (distance <= *best && i->id != exclude_id) {
+            *best = distance;
+            *found_target = *i;
+            found = true;
+        }
+    }
+    // hacia la izquierda, igual
+    for (auto i = start; i != targets.begin();) {
+        i--;
+        double dx = x - i->x;
+        if (dx * dx > *best) break;
+        double dy = i->y - y;
+        double distance = dx * dx + dy * dy;
+        if (distance <= *best && i->id != exclude_id) {
+            *best = distance;
+            *found_target = *i;
+            found = true;
+        }
+    }
+    return found;
+}
+
+bool Perception::shouldSimulate(const Zombie& zombie) const {
+    if (zombie.near_team || zombie.dying || zombie.being_hurt) return true;
+    return ((zombie.zombie_id + tick) % far_slices) == 0;
+}
+
+double Perception::distanceToTeam(double x) const {
+    double distance = std::numeric_limits<double>::max();
+    auto right = std::lower_bound(live_soldiers.begin(), live_soldiers.end(), Target{x, 0, 0}, compareByX);
+    if (right != live_soldiers.end()) distance = right->x - x;
+    if (right != live_soldiers.begin()) distance = std::min(distance, x - std::prev(right)->x);
+    if (!live_soldiers.empty()) {
+        // los de los extremos tambien estan cerca dando la vuelta
+        distance = std::min(distance, x + period - live_soldiers.back().x);
+        distance = std::min(distance, live_soldiers.front().x + period - x);
+    }
+    return distance;
+}
+
+void Perception::separation(const Zombie& zombie, double *sep_x, double *sep_y) const {
+    *sep_x = 0;
+    *sep_y = 0;
+    if (separation_radius <= 0 || separation_weight <= 0) return;
+    double x = zombie.seePosition().getXPos();
+    double y = zombie.seePosition().getYPos();
+    double radius_2 = separation_radius * separation_radius;
+    auto start = std::lower_bound(live_zombies.begin(), live_zombies.end(),
+        Target{x - separation_radius, 0, 0}, compareByX);
+
+    for (auto i = start; i != live_zombies.end(); i++) {
+        double dx = x - i->x;
+        if (dx < -separation_radius) break;
+        if (i->id == zombie.zombie_id) continue;
+        double dy = y - i->y;
+        double distance = dx * dx + dy * dy;
+        if (distance >= radius_2) continue;
+        // superpuestos: desempato por id para que no se queden pegados
+        if (distance == 0) { *sep_x += (zombie.zombie_id < i->id) ? -1.0 : 1.0; continue; }
+        // empuje lineal en la distancia al cuadrado, sin raices
+        double push = (radius_2 - distance) / (radius_2 * separation_radius);
+        *sep_x += dx * push;
+        *sep_y += dy * push;
+    }
+    *sep_x *= separation_weight;
+    *sep_y *= separation_weight;
+}
@@ -1,5 +1,8 @@
 #include "../../include/GameLogic/position.h"
 
+#include <cmath>
+#include <limits>
+
 Position::Position(
     double x,
     double y,
@@ -12,7 +15,10 @@ Position::Position(
     width(width),
     height(height),
     dim_x(dim_x),
-    dim_y(dim_y) {
+    dim_y(dim_y),
+    half_width(width * 0.5),
+    half_height(height * 0.5),
+    period(dim_x > 0.0 ? dim_x + 1.0 : std::numeric_limits<double>::infinity()) {
             if (x < 0.0) this->x = dim_x + x + 1.0;
             if (x > dim_x) this->x = x - dim_x - 1.0;
             if (y <= 0.0) this->y = height * 0.5;
@@ -20,54 +26,29 @@ Position::Position(
     }
 
 bool Position::collides(const Position &other) const {
-    std::tuple<double, double, bool> area_other_x = other.getXArea();
-    std::tuple<double, double, bool> area_other_y = other.getYArea();
-    std::tuple<double, double, bool> area_x = getXArea();
-    std::tuple<double, double, bool> area_y = getYArea();
-
-    double y_min_other, y_max_other, y_min, y_max;
-    double x_min_other, x_max_other, x_min, x_max;
-
-    bool hits_x = false;
-    bool hits_y = false;
-
-    // ambos son complementos quiere decir que ambos ocupan los limites del mapa
-    if (!std::get<2>(area_other_x) && !std::get<2>(area_x)) {
-        hits_x = true;
-
-    // solo area_x es complemento, Tengo que ver si other está fuera.
-    } else if (std::get<2>(area_other_x) && !std::get<2>(area_x)) {
-        x_min_other = std::get<0>(area_other_x);
-        x_max_other = std::get<1>(area_other_x);
-        x_min = std::get<0>(area_x);
-        x_max = std::get<1>(area_x);
-        hits_x = !(((x_min <= x_max_other) && (x_max_other <= x_max)) || ((x_min <= x_min_other) && (x_min_other <= x_max)));
-
-    // solo area_other_x es complemento, Tengo que ver si area está fuera
-    } else if (!std::get<2>(area_other_x) && std::get<2>(area_x)) {
-        x_min_other = std::get<0>(area_other_x);
-        x_max_other = std::get<1>(area_other_x);
-        x_min = std::get<0>(area_x);
-        x_max = std::get<1>(area_x);
-        hits_x = (((x_min_other <= x_max) && (x_max <= x_max_other)) || ((x_min_other <= x_min) && (x_min <= x_max_other)));
-
-    // ninguno es complemento, Tengo que comparar normal
-    } else if (std::get<2>(area_other_x) && std::get<2>(area_x)) {
-        x_min_other = std::get<0>(area_other_x);
-        x_max_other = std::get<1>(area_other_x);
-        x_min = std::get<0>(area_x);
-        x_max = std::get<1>(area_x);
-        hits_x = (((x_min <= x_max_other) && (x_max_other <= x_max)) || ((x_min <= x_min_other) && (x_min_other <= x_max)));
+    // en x me quedo con la menor distancia entre las dos vueltas del mapa
+    double dx = std::abs(x - other.x);
+    dx = std::fmin(dx, period - dx);
+    double dy = std::abs(y - other.y);
+    return (dx <= half_width + other.half_width) & (dy <= half_height + other.half_height);
+}
+
+size_t Position::collides(const Aabb *others, size_t count, uint8_t *hits) const {
+    size_t total = 0;
+    for (size_t i = 0; i < count; i++) {
+        double dx = std::abs(x - others[i].x);
+        dx = std::fmin(dx, period - dx);
+        double dy = std::abs(y - others[i].y);
+        uint8_t hit = (dx <= half_width + others[i].half_width) & (dy <= half_height + others[i].half_height);
+        hits[i] = hit;
+        total += hit;
     }
-    // comparo Y. Tengo que comparar normal
-    y_min_other = std::get<0>(area_other_y);
-    y_max_other = std::get<1>(area_other_y);
-    y_min = std::get<0>(area_y);
-    y_max = std::get<1>(area_y);
-    hits_y = (((y_min <= y_max_other) && (y_max_other <= y_max)) || ((y_min <= y_min_other) && (y_min_other <= y_max)));
-    return (hits_x && hits_y);
+    return total;
 }
 
+Aabb Position::getAabb() const {
+    return Aabb{x, y, half_width, half_height};
+}
 
 double Position::getXPos(void) const {
     return x;
@@ -1,4 +1,5 @@
 #include "../../include/GameLogic/radialhitbox.h"
+#include "../../include/GameLogic/vec2.h"
 #include<cmath>
 #include <iostream>
 
@@ -18,9 +19,7 @@ void RadialHitbox::setValues(double new_x, double new_y, double new_radius) {
 }
 
 bool RadialHitbox::hits(const Position &victim_position) {
-    double other_x = victim_position.getXPos();
-    double other_y = victim_position.getYPos();
-
-    double distance = std::sqrt(std::pow(std::abs(x - other_x), 2) + std::pow(std::abs(y - other_y), 2));
-    return (distance <= radius);
+    // en x por el lado mas corto del mapa
+    Vec2 distance{wrapDelta(x, victim_position.getXPos(), victim_position.period), victim_position.getYPos() - y};
+    return (distance.lengthSq() <= radius * radius);
 }
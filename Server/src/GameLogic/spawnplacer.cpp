@@ -0,0 +1,108 @@
+#include "../../include/GameLogic/spawnplacer.h"
+#include "../../include/GameLogic/Soldiers/soldier.h"
+
+#include <algorithm>
+#include <cmath>
+
+// la entidad se corre hasta un cuarto de celda para que no queden alineadas
+#define JITTER 0.25
+
+SpawnPlacer::SpawnPlacer(uint32_t seed) {
+    this->seed(seed);
+}
+
+void SpawnPlacer::seed(uint32_t seed) {
+    if (seed == 0) {
+        std::random_device rd;
+        seed = rd();
+    }
+    rng.seed(seed);
+    valid = false;
+}
+
+void SpawnPlacer::reset(void) {
+    valid = false;
+}
+
+size_t SpawnPlacer::freeSlots(void) const {
+    return free_slots.size();
+}
+
+Position SpawnPlacer::place(const std::map<uint32_t, std::shared_ptr<Soldier>> &soldiers,
+    double new_center, double new_range, double new_width, double new_height, double new_dim_x, double new_dim_y) {
+    if (!valid || new_center != center || new_range != range || new_width != width
+        || new_height != height || new_dim_x != dim_x || new_dim_y != dim_y) {
+        center = new_center;
+        range = new_range;
+        width = new_width;
+        height = new_height;
+        dim_x = new_dim_x;
+        dim_y = new_dim_y;
+        build(soldiers);
+    }
+
+    std::uniform_real_distribution<double> jitter(-JITTER, JITTER);
+    if (free_slots.empty()) {
+        // el area entera esta tapada por soldados, no hay lugar libre que buscar
+        std::uniform_real_distribution<double> distx(center - range, center + range);
+        std::uniform_real_distribution<double> disty(0, dim_y);
+        return Position(distx(rng), disty(rng), width, height, dim_x, dim_y);
+    }
+    if (remaining == 0) remaining = free_slots.size();
+
+    std::uniform_int_distribution<size_t> pick(0, remaining - 1);
+    size_t chosen = pick(rng);
+    remaining--;
+    std::swap(free_slots[chosen], free_slots[remaining]);
+    uint32_t slot = free_slots[remaining];
+
+    double x = center - range + ((slot % cols) + 0.5 + jitter(rng)) * cell_width;
+    double y = (rows > 1) ? ((slot / cols) + 0.5 + jitter(rng)) * cell_height : dim_y * 0.5;
+    return Position(x, y, width, height, dim_x, dim_y);
+}
+
+void SpawnPlacer::build(const std::map<uint32_t, std::shared_ptr<Soldier>> &soldiers) {
+    valid = true;
+    double safe_width = (width > 0) ? width : 1.0;
+    double safe_height = (height > 0) ? height : 1.0;
+    cols = std::max<uint32_t>(1, static_cast<uint32_t>((2 * range) / safe_width));
+    rows = std::max<uint32_t>(1, static_cast<uint32_t>(dim_y / safe_height));
+    cell_width = (range > 0) ? std::min(safe_width, (2 * range) / cols) : safe_width;
+    cell_height = safe_height;
+    occupied.assign(static_cast<size_t>(cols) * rows, 0);
+
+    double period = (dim_x > 0) ? dim_x + 1.0 : 0.0;
+    for (const auto & soldier : soldiers) {
+        const Position &other = soldier.second->seePosition();
+        // una celda esta ocupada si la entidad, corrida lo maximo, toca al soldado
+        double reach_x = other.half_width + width * 0.5 + cell_width * JITTER;
+        // con una sola fila la entidad va al medio, marco la columna entera
+        int64_t first_row = 0;
+        int64_t last_row = 0;
+        if (rows > 1) {
+            double reach_y = other.half_height + height * 0.5 + cell_height * JITTER;
+            first_row = std::max<int64_t>(0, static_cast<int64_t>(std::ceil((other.getYPos() - reach_y) / cell_height - 0.5)));
+            last_row = std::min<int64_t>(rows - 1, static_cast<int64_t>(std::floor((other.getYPos() + reach_y) / cell_height - 0.5)));
+        }
+        // distancia en x al borde izquierdo del area; si el area es mas ancha
+        // que el mapa el soldado aparece en ella una vez por vuelta
+        double rel = other.getXPos() - (center - range);
+        if (period > 0) rel -= period * std::floor((rel + reach_x) / period);
+        do {
+            int64_t first_col = std::max<int64_t>(0, static_cast<int64_t>(std::ceil((rel - reach_x) / cell_width - 0.5)));
+            int64_t last_col = std::min<int64_t>(cols - 1, static_cast<int64_t>(std::floor((rel + reach_x) / cell_width - 0.5)));
+            for (int64_t row = first_row; row <= last_row; row++) {
+                for (int64_t col = first_col; col <= last_col; col++) {
+                    occupied[row * cols + col] = 1;
+                }
+            }
+            rel += period;
+        } while (period > 0 && rel - reach_x <= 2 * range);
+    }
+
+    free_slots.clear();
+    for (uint32_t slot = 0; slot < occupied.size(); slot++) {
+        if (!occupied[slot]) free_slots.push_back(slot);
+    }
+    remaining = free_slots.size();
+}
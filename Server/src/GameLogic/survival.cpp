@@ -1,4 +1,5 @@
 #include "../../include/GameLogic/survival.h"
+#include "yaml-cpp/yaml.h"
 
 Survival::Survival(double x_dimension, double y_dimension, uint8_t difficulty, uint32_t code) :
     Match(x_dimension, y_dimension, code) {
@@ -6,9 +7,7 @@ Survival::Survival(double x_dimension, double y_dimension, uint8_t difficulty, u
 }
 
 void Survival::simulateStep(std::chrono::_V2::system_clock::time_point real_time) {
-    for (auto & zombie : zombies) {
-        zombie.second->simulate(real_time, std::ref(soldiers), std::ref(zombies), std::ref(throwables), x_dim, y_dim, t_factory);
-    }
+    simulateZombies(real_time);
     //delete_dead_zombies();
 
     for (auto & throwable : throwables) {
@@ -16,17 +15,18 @@ void Survival::simulateStep(std::chrono::_V2::system_clock::time_point real_time
     }
     // delete_inactive_throwables();
 
+    // posiciones de este tick para todos los disparos
+    hit_scan.load(zombies);
     for (auto & soldier : soldiers) {
         soldier.second->simulate(real_time, std::ref(soldiers), std::ref(zombies), std::ref(throwables), x_dim, y_dim, t_factory, calculate_mass_center());
     }
+    // todo el daño del tick junto, no importa el orden en que se simularon
+    damage_buffer.resolve(real_time, soldiers, zombies);
     delete_dead_soldiers();
 
     if ((dead_soldiers_counter == soldier_counter) && finalizable) loseMatch();
-    std::chrono::duration<double> time = real_time - actual_time;
-    if (time.count() > 30) {
-        actual_time = real_time;
-        add_zombies();
-    }
+    // oleadas repartidas en varios ticks
+    director.step(real_time, *this);
 }
 
 void Survival::loseMatch(void) {
@@ -34,9 +34,15 @@ void Survival::loseMatch(void) {
 }
 
 void Survival::configurate(uint8_t difficulty) {
-    configurator.configurate(SURVIVAL, difficulty, zombies, soldiers, x_dim, y_dim, &code_counter, &zombie_counter, calculate_mass_center());
+    configurator.configurate(SURVIVAL, difficulty, zombies, soldiers, x_dim, y_dim, &code_counter, &zombie_counter, calculate_mass_center(), spawner);
+    attachDamageBuffer();
+
+    YAML::Node waves = YAML::LoadFile(SERVER_CONFIG_PATH "/config.yaml")["waves"];
+    director.configure(waves["interval"].as<double>(), waves["growth"].as<double>(),
+        waves["max_per_tick"].as<size_t>(), waves["budget_ms"].as<double>(), waves["prewarm"].as<size_t>());
+    // cada oleada arranca con la composicion inicial de la dificultad
+    director.setComposition({{ZOMBIE, configurator.amount_infected}, {SPEAR, configurator.amount_spear},
+        {JUMPER, configurator.amount_jumper}, {VENOM, configurator.amount_venom},
+        {WITCH, configurator.amount_witch}});
+    director.start(create_time);
 }
-
-void Survival::add_zombies(void) {
-    configurator.add_zombies(1, zombies, soldiers, x_dim, y_dim, &code_counter, &zombie_counter, calculate_mass_center());
-}
\ No newline at end of file
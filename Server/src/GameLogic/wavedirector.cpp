@@ -0,0 +1,119 @@
+#include "../../include/GameLogic/wavedirector.h"
+#include "../../include/GameLogic/match.h"
+
+#include <algorithm>
+#include <cmath>
+
+void WaveDirector::configure(double new_interval, double new_growth, size_t new_max_per_tick,
+    double budget_ms, size_t new_prewarm) {
+    interval = std::chrono::duration<double>(new_interval);
+    growth = new_growth;
+    max_per_tick = (new_max_per_tick == 0) ? 1 : new_max_per_tick;
+    budget = std::chrono::duration<double>(budget_ms / 1000.0);
+    prewarm = new_prewarm;
+}
+
+void WaveDirector::setComposition(const std::vector<std::pair<uint8_t, uint32_t>>& new_composition) {
+    composition = new_composition;
+}
+
+void WaveDirector::start(std::chrono::_V2::system_clock::time_point now) {
+    last_wave = now;
+}
+
+void WaveDirector::launchWave(void) {
+    waves++;
+    double scale = 1.0 + growth * (waves - 1);
+    std::vector<uint32_t> left;
+    uint32_t total = 0;
+    for (auto & type : composition) {
+        left.push_back(static_cast<uint32_t>(std::ceil(type.second * scale)));
+        total += left.back();
+    }
+    // reparto por turnos: infected, spear, jumper, ... y de nuevo
+    while (total > 0) {
+        for (size_t i = 0; i < composition.size(); i++) {
+            if (left[i] == 0) continue;
+            queue.push_back(composition[i].first);
+            left[i]--;
+            total--;
+        }
+    }
+}
+
+void WaveDirector::step(std::chrono::_V2::system_clock::time_point real_time, Match &match) {
+    auto begin = std::chrono::steady_clock::now();
+    if (real_time - last_wave > interval) {
+        last_wave = real_time;
+        launchWave();
+    }
+
+    size_t done = 0;
+    if (!queue.empty()) {
+        // una grilla de lugares libres para todo lo que entra en este tick
+        match.spawner.reset();
+        double mass_center = match.calculate_mass_center();
+        // siempre entra al menos uno, asi la oleada avanza aunque el tick venga lento
+        do {
+            spawn(queue.front(), real_time, match, mass_center);
+            queue.pop_front();
+            done++;
+        } while (!queue.empty() && done < max_per_tick
+            && std::chrono::steady_clock::now() - begin < budget);
+        return;
+    }
+
+    while (done < max_per_tick && std::chrono::steady_clock::now() - begin < budget && prewarmOne()) {
+        done++;
+    }
+}
+
+void WaveDirector::spawn(uint8_t type, std::chrono::_V2::system_clock::time_point real_time,
+    Match &match, double mass_center) {
+    uint32_t id = match.code_counter++;
+    std::shared_ptr<Zombie> zombie;
+    std::vector<std::shared_ptr<Zombie>> &ready = pool[type];
+    if (ready.empty()) {
+        zombie = factory.create(id, type);
+    } else {
+        zombie = std::move(ready.back());
+        ready.pop_back();
+        zombie->zombie_id = id;
+    }
+    // el dt del primer paso se cuenta desde que entra, no desde que se precreo
+    zombie->last_step_time = real_time;
+    zombie->setRandomPosition(match.spawner, match.soldiers, match.x_dim, match.y_dim, mass_center);
+    zombie->damage_buffer = &match.damage_buffer;
+    match.zombies.emplace(id, std::move(zombie));
+    match.zombie_counter += 1;
+}
+
+bool WaveDirector::prewarmOne(void) {
+    uint8_t type = 0;
+    size_t fewest = prewarm;
+    for (auto & entry : composition) {
+        if (entry.second == 0) continue;
+        size_t have = pool[entry.first].size();
+        if (have < fewest) {
+            fewest = have;
+            type = entry.first;
+        }
+    }
+    if (fewest >= prewarm) return false;
+    pool[type].push_back(factory.create(0, type));
+    return true;
+}
+
+size_t WaveDirector::pending(void) const {
+    return queue.size();
+}
+
+size_t WaveDirector::pooled(void) const {
+    size_t total = 0;
+    for (auto & entry : pool) total += entry.second.size();
+    return total;
+}
+
+uint32_t WaveDirector::wavesLaunched(void) const {
+    return waves;
+}
@@ -0,0 +1,70 @@
+#include "../../include/GameLogic/workerpool.h"
+
+#include <algorithm>
+
+WorkerPool::WorkerPool(size_t workers) {
+    for (size_t i = 0; i < workers; i++) {
+        threads.emplace_back(&WorkerPool::workerLoop, this, i + 1);
+    }
+}
+
+WorkerPool::~WorkerPool() {
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        stopping = true;
+    }
+    work_cv.notify_all();
+    for (auto & thread : threads) thread.join();
+}
+
+size_t WorkerPool::lanes(void) const {
+    return threads.size() + 1;
+}
+
+void WorkerPool::parallelFor(size_t new_count, size_t new_chunk, const Job& new_job) {
+    if (new_count == 0) return;
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        job = &new_job;
+        count = new_count;
+        chunk = (new_chunk == 0) ? 1 : new_chunk;
+        next = 0;
+        busy = threads.size();
+        error = nullptr;
+        generation++;
+    }
+    work_cv.notify_all();
+    drain(0);
+
+    std::unique_lock<std::mutex> lock(mtx);
+    done_cv.wait(lock, [this] { return busy == 0; });
+    job = nullptr;
+    if (error) std::rethrow_exception(error);
+}
+
+void WorkerPool::workerLoop(size_t lane) {
+    uint64_t seen = 0;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(mtx);
+            work_cv.wait(lock, [this, seen] { return stopping || generation != seen; });
+            if (stopping) return;
+            seen = generation;
+        }
+        drain(lane);
+        std::lock_guard<std::mutex> lock(mtx);
+        if (--busy == 0) done_cv.notify_one();
+    }
+}
+
+void WorkerPool::drain(size_t lane) {
+    size_t begin;
+    while ((begin = next.fetch_add(chunk)) < count) {
+        try {
+            (*job)(begin, std::min(begin + chunk, count), lane);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(mtx);
+            if (!error) error = std::current_exception();
+        }
+    }
+}
@@ -1,11 +1,35 @@
+#include <chrono>
+#include <thread>
 #include "../include/accepter.h"
+#include "../include/protocol.h"
+#include "../../Common/include/Information/feedback_server_full.h"
+#include "yaml-cpp/yaml.h"
 
-constexpr std::uint32_t MAX_GAMES = 10;
+Accepter::Accepter(const std::string& servname, int backlog, bool reuse_port, int reap_ms,
+                   GameManager& game_manager, Admission& admission) :
+    skt(servname.c_str(), backlog, reuse_port),
+    game_manager(game_manager),
+    admission(admission),
+    clients(),
+    options(loadSocketOptions()),
+    reap_ms(reap_ms) {
+}
 
-Accepter::Accepter(const std::string& servname) :
-    skt(servname.c_str()),
-    game_manager(),
-    clients() {
+SocketOptions Accepter::loadSocketOptions() {
+    YAML::Node socket = YAML::LoadFile(SERVER_CONFIG_PATH "/config.yaml")["socket"];
+    SocketOptions options;
+    options.no_delay = socket["nodelay"].as<bool>();
+    options.quick_ack = socket["quickack"].as<bool>();
+    options.cork = socket["cork"].as<bool>();
+    options.send_buffer = socket["send_buffer"].as<int>();
+    options.recv_buffer = socket["recv_buffer"].as<int>();
+    options.keepalive = socket["keepalive"].as<bool>();
+    options.keepalive_idle = socket["keepalive_idle"].as<int>();
+    options.keepalive_interval = socket["keepalive_interval"].as<int>();
+    options.keepalive_count = socket["keepalive_count"].as<int>();
+    options.send_timeout_ms = socket["send_timeout_ms"].as<int>();
+    options.recv_timeout_ms = socket["recv_timeout_ms"].as<int>();
+    return options;
 }
 
 void Accepter::run() {
@@ -15,10 +39,17 @@ void Accepter::run() {
 
     try {
     while (true) {
-        GameSocket peer = skt.acceptClient();
-        auto* receiver = new Receiver(std::move(peer), game_manager);
-        clients.push_back(receiver);
-        receiver->start();
+        try {
+            if (skt.waitIncoming(reap_ms)) admit(skt.acceptClient());
+        } catch (const AcceptFailed& e) {
+            // EINTR, ECONNABORTED...: se reintenta. Sin fds o memoria se
+            // liberan los que terminaron y se espera antes de volver a aceptar
+            if (e.out_of_resources) backOff(e.what());
+        } catch (const ClosedSocket& err) {
+            throw;
+        } catch (const exception& e) {
+            backOff(e.what());
+        }
         reapDead();
     }
     } catch (const ClosedSocket& err) {
@@ -32,6 +63,36 @@ void Accepter::run() {
     }
 }
 
+void Accepter::backOff(const char* reason) {
+    std::cerr << "Accepter backing off: " << reason << std::endl;
+    reapDead();
+    std::this_thread::sleep_for(std::chrono::milliseconds(reap_ms));
+}
+
+void Accepter::admit(GameSocket&& peer) {
+    if (!admission.tryAdmit()) {
+        // se avisa y se cierra enseguida, sin crear hilos
+        try {
+            Protocol(peer).sendFeedback(ServerFullFeedback(FULL_CONNECTIONS));
+            peer.discardInput();
+        } catch (const std::exception& e) {
+            // ya se habia ido
+        }
+        return;
+    }
+    Receiver* receiver = nullptr;
+    try {
+        receiver = new Receiver(std::move(peer), game_manager, options);
+    } catch (const std::exception& e) {
+        // se pierde este cliente, no el cupo ni el accepter
+        admission.release();
+        std::cerr << "Accepter could not admit a client: " << e.what() << std::endl;
+        return;
+    }
+    clients.push_back(receiver);
+    receiver->start();
+}
+
 void Accepter::stop() {
     skt._shutdown(SHUT_RDWR);
     skt._close();
@@ -42,15 +103,17 @@ void Accepter::killAll() {
         if (!client->isDead()) (client)->stop();
         (client)->join();
         delete client;
+        admission.release();
     }
     clients.clear();
 }
 
 void Accepter::reapDead() {
-    clients.remove_if([](Receiver* client) {
+    clients.remove_if([this](Receiver* client) {
         if (client->isDead()) {
             client->join();
             delete client;
+            admission.release();
             return true;
         }
         return false;
@@ -0,0 +1,30 @@
+#include "../include/admission.h"
+
+Admission::Admission(std::size_t max_connections) :
+    max_connections(max_connections),
+    connections(0),
+    rejected(0) {
+}
+
+bool Admission::tryAdmit() {
+    std::size_t current = connections.load();
+    do {
+        if (current >= max_connections) {
+            rejected++;
+            return false;
+        }
+    } while (!connections.compare_exchange_weak(current, current + 1));
+    return true;
+}
+
+void Admission::release() {
+    connections--;
+}
+
+std::size_t Admission::active() const {
+    return connections;
+}
+
+std::uint64_t Admission::rejectedCount() const {
+    return rejected;
+}
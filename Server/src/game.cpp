@@ -1,16 +1,24 @@
 #include <chrono>
 #include "../include/game.h"
 
-Game::Game(std::uint8_t max_players, uint8_t gameMode, uint8_t gameDifficulty, uint32_t game_code) :
+Game::Game(std::uint8_t max_players, uint8_t gameMode, uint8_t gameDifficulty, uint32_t game_code,
+           LobbyIndex* lobby) :
         max_players(max_players),
         players_amount(0),
+        connected(0),
         is_running(true),
         started(false),
+        finished(false),
+        mode(gameMode),
+        difficulty(gameDifficulty),
+        code(game_code),
         commands_recv(10000),
         player_queues(),
-        match(nullptr) {
+        player_rates(),
+        members(),
+        match(nullptr),
+        lobby(lobby) {
     selectMode(gameMode, gameDifficulty, game_code);
-    player_queues.reserve(max_players);
 }
 
 /*
@@ -19,21 +27,48 @@ Game::addAdmin(std::uint8_t player_id) {
 }
 */
 
-void Game::join(Queue<std::shared_ptr<InGameCommand>> *&game_queue, const std::shared_ptr<Queue<std::shared_ptr<Information>>> &player_queue,
-                std::uint8_t* player_id) {
+bool Game::join(Queue<std::shared_ptr<InGameCommand>> *&game_queue, const std::shared_ptr<Queue<std::shared_ptr<Information>>> &player_queue,
+                std::uint8_t* player_id, const std::shared_ptr<SnapshotRate> &rate,
+                const std::shared_ptr<Information> &accepted) {
     std::unique_lock<std::mutex> lck(mtx);
+    // el hilo corta is_running con mtx tomado, despues de eso no manda mas nada
+    if (finished || !is_running || isFull()) return false;
+    // si la cola esta cerrada tira antes de sumarlo
+    if (accepted) player_queue->push(accepted);
 
     game_queue = &this->commands_recv;
 
-    player_queues.push_back(player_queue);
-
     // Also a random function could be used for the ids.
     *player_id = ++players_amount;
 
+    player_queues.emplace(*player_id, player_queue);
+    members.emplace_back(player_queue);
+    if (rate) player_rates.emplace(*player_id, rate);
+
+    connected++;
+
     // Game starts when max_players is reached.
     if (isFull()) {
         started = true;
     }
+    publish();
+    return true;
+}
+
+void Game::publish() {
+    if (!lobby) return;
+    if (finished || !is_running || isFull()) {
+        lobby->remove(code, mode, difficulty);
+        return;
+    }
+    lobby->update(summary());
+}
+
+void Game::dropPlayer(std::uint8_t player_id) {
+    player_rates.erase(player_id);
+    match->forgetPlayer(player_id);
+    connected--;
+    publish();
 }
 
 void Game::selectMode(uint8_t gameMode, uint8_t gameDifficulty, uint32_t game_code) {
@@ -54,6 +89,23 @@ bool Game::isEmpty() const {
     return players_amount == 0;
 }
 
+bool Game::isFinished() const {
+    return finished;
+}
+
+bool Game::isDone() {
+    if (!finished) return false;
+    std::unique_lock<std::mutex> lck(mtx);
+    for (const auto& member : members) {
+        if (!member.expired()) return false;
+    }
+    return true;
+}
+
+GameSummaryDTO Game::summary() const {
+    return GameSummaryDTO{code, mode, difficulty, connected, max_players};
+}
+
 void Game::stop() {
     is_running = false;
 }
@@ -63,7 +115,8 @@ void Game::run() {
     using std::chrono::milliseconds;
     using std::chrono::_V2::system_clock;
 
-    while (is_running && players_amount > 0) {
+    // modo desconocido: no hay match que simular y la partida termina sola
+    while (is_running && players_amount > 0 && match) {
         std::chrono::_V2::system_clock::time_point start = std::chrono::system_clock::now();
         sleep_for(milliseconds(5));
         std::unique_lock<std::mutex> lck(mtx);
@@ -74,25 +127,41 @@ void Game::run() {
             command->execute(match);
         if (!(match->is_over())) {
             match->simulateStep(start);
-            std::vector<std::pair<short unsigned int, ElementStateDTO>>state = match->getElementStates();
-            const std::shared_ptr<Information>& feedback_ptr = std::make_shared<GameStateFeedback>(std::move(state));
             for (auto player_queue = player_queues.begin(); player_queue !=player_queues.end(); ) {
                 try {
-                    if (!(*player_queue)) {
+                    if (!(player_queue->second)) {
+                        dropPlayer(player_queue->first);
                         player_queue = player_queues.erase(player_queue);
                         continue;
                     }
-                    if (!(*player_queue)->try_push(feedback_ptr)) {
-                        player_queue = player_queues.erase(player_queue);
+                    auto rate = player_rates.find(player_queue->first);
+                    const std::shared_ptr<SnapshotRate>* player_rate =
+                            (rate != player_rates.end()) ? &rate->second : nullptr;
+                    // cliente congestionado: este tick no le toca
+                    if (player_rate && !(*player_rate)->shouldSend()) {
+                        player_queue++;
                         continue;
                     }
+                    // Cada jugador recibe solo su area de interes y los ids que salieron de ella.
+                    std::vector<std::pair<uint16_t, ElementStateDTO>> state = match->getElementStates(player_queue->first);
+                    std::vector<uint16_t> left = match->updateInterest(player_queue->first, state);
+                    auto feedback_ptr = std::make_shared<GameStateFeedback>(std::move(state), std::move(left));
+                    if (player_rate) (*player_rate)->enqueued();
+                    if (!player_queue->second->try_push(feedback_ptr)) {
+                        // cola llena: se saltea este snapshot en vez de echarlo
+                        if (player_rate) (*player_rate)->dropped();
+                        match->restoreInterest(player_queue->first, feedback_ptr->left_elements);
+                    }
                 } catch(const ClosedQueue& e) {
                     std::cout << e.what() << std::endl;
-                    player_queues.erase(player_queue);
+                    dropPlayer(player_queue->first);
+                    player_queue = player_queues.erase(player_queue);
                     continue;
                 }
                 player_queue++;
             }
+            // se fueron todos los jugadores
+            if (player_queues.empty()) is_running = false;
             continue;
         }
         // si se terminó, mando el score
@@ -100,23 +169,30 @@ void Game::run() {
         const std::shared_ptr<Information>& feedback_ptr = std::make_shared<GameScoreFeedback>(std::move(score));
         for (auto player_queue = player_queues.begin(); player_queue !=player_queues.end(); ) {
             try {
-                if (!(*player_queue)) {
+                if (!(player_queue->second)) {
                     player_queue = player_queues.erase(player_queue);
                     continue;
                 }
-                if (!(*player_queue)->try_push(feedback_ptr)) {
+                if (!player_queue->second->try_push(feedback_ptr)) {
                     player_queue = player_queues.erase(player_queue);
                     continue;
                 }
             } catch(const ClosedQueue& e) {
                 std::cout << e.what() << std::endl;
-                player_queues.erase(player_queue);
+                player_queue = player_queues.erase(player_queue);
                 continue;
             }
             player_queue++;
         }
         is_running = false;
     }
+    // suelta las colas para que solo las tengan sus Receiver
+    std::unique_lock<std::mutex> lck(mtx);
+    player_queues.clear();
+    player_rates.clear();
+    finished = true;
+    connected = 0;
+    publish();
 }
 
 bool Game::isFull() const {
@@ -1,7 +1,9 @@
 #include <random>
+#include <algorithm>
 #include "../include/game_manager.h"
 #include "../../Common/include/Information/feedback_server_creategame.h"
 #include "../../Common/include/Information/feedback_server_joingame.h"
+#include "../../Common/include/Information/feedback_server_full.h"
 #include "../../Common/include/Information/information_code.h"
 
 /*
@@ -32,12 +34,12 @@ std::uint32_t GameManager::generateGameCode() {
     return game_code;
 }
 
-void GameManager::cleanEmptyGames() {
+void GameManager::takeFinishedGames() {
     for (auto game = games.begin(); game != games.end(); ) {
-        if (game->second->isEmpty()) {
-            game->second->stop();
-            game->second->Thread::join();
-            delete game->second;
+        if (game->second->isDone()) {
+            GameSummaryDTO summary = game->second->summary();
+            lobby.remove(summary.game_code, summary.mode, summary.difficulty);
+            finished_games.push_back(game->second);
             game = games.erase(game);
         } else {
             ++game;
@@ -45,24 +47,57 @@ void GameManager::cleanEmptyGames() {
     }
 }
 
+void GameManager::reap() {
+    std::unique_lock<std::mutex> lck(mtx);
+    while (!stopping) {
+        reap_cv.wait_for(lck, reap_period);
+        takeFinishedGames();
+        std::vector<Game*> to_free;
+        to_free.swap(finished_games);
+        // join y delete sin frenar a los que crean o se unen
+        lck.unlock();
+        for (Game* game : to_free) {
+            game->stop();
+            game->Thread::join();
+            delete game;
+        }
+        lck.lock();
+    }
+}
+
 void GameManager::cleanAllGames() {
     for (auto & game : games) {
-        game.second->stop();
-        game.second->Thread::join();
-        delete game.second;
+        finished_games.push_back(game.second);
+    }
+    games.clear();
+    for (Game* game : finished_games) {
+        game->stop();
+        game->Thread::join();
+        delete game;
     }
+    finished_games.clear();
 }
 
 //-----------------------PUBLIC----------------------------//
-GameManager::GameManager() :
-        games() {
+GameManager::GameManager(std::size_t max_games, int reap_ms, std::size_t list_max,
+                         std::size_t match_players, int match_wait_ms) :
+        games(),
+        max_games(std::min<std::size_t>(max_games, MAX_SIZE)),
+        lobby(),
+        list_max(list_max),
+        matchmaker(*this, match_players, match_wait_ms),
+        finished_games(),
+        reap_period(std::max(1, reap_ms)),
+        reap_cv(),
+        stopping(false),
+        reaper(&GameManager::reap, this) {
 }
 
 std::uint32_t GameManager::createGame(Queue<std::shared_ptr<InGameCommand>> *&game_queue,
                                       const std::shared_ptr<Queue<std::shared_ptr<Information>>> &player_queue,
-                                      std::uint8_t *player_id, uint8_t gameMode, uint8_t gameDifficulty) {
+                                      std::uint8_t *player_id, uint8_t gameMode, uint8_t gameDifficulty,
+                                      const std::shared_ptr<SnapshotRate> &rate) {
     using std::uint32_t;
-    using std::runtime_error;
     using std::pair;
 
     using std::shared_ptr;
@@ -77,29 +112,33 @@ std::uint32_t GameManager::createGame(Queue<std::shared_ptr<InGameCommand>> *&ga
      *
      */
     unique_lock<mutex> lck(mtx);
-    if (games.size() >= MAX_SIZE) {
-        /*
-         * Could use a specific type of Exception to avoid stopping the User for
-         * joining other game for example, or wait for a game to finish.
-         * This will stop the Receiver and therefore the Client from
-         * communicating with the Server.
-         */
-        throw runtime_error("Maximum games capacity reached.\n");
+    // en el tope se sacan las terminadas ya, el reaper las libera despues
+    if (games.size() >= max_games) {
+        takeFinishedGames();
+        reap_cv.notify_one();
+    }
+    if (games.size() >= max_games) {
+        // no se corta la conexion: todavia puede unirse a otra partida
+        player_queue->push(make_shared<ServerFullFeedback>(FULL_GAMES));
+        return 0;
     }
 
     std::uint32_t game_code = generateGameCode();
-    // Game could receive game_code to inform the player when it asks for it.
-    Game* game = new Game(MAX_PLAYERS, gameMode, gameDifficulty, game_code);
 
     // Creates the smart pointer for RAII
     shared_ptr<CreateGameFeedback> create_feed =
             make_shared<CreateGameFeedback>(game_code);
 
-    // Push feedback for the player before joining
+    // Push feedback for the player before joining (if its queue is closed
+    // it throws before the game exists)
     player_queue->push(create_feed);
 
+    // Game could receive game_code to inform the player when it asks for it.
+    // The game lists itself in the lobby while someone can still join.
+    Game* game = new Game(MAX_PLAYERS, gameMode, gameDifficulty, game_code, &lobby);
+
     // Join the player
-    game->join(game_queue, player_queue, player_id);
+    game->join(game_queue, player_queue, player_id, rate);
 
     pair<uint32_t, Game*> hash(game_code, game);
 
@@ -107,14 +146,14 @@ std::uint32_t GameManager::createGame(Queue<std::shared_ptr<InGameCommand>> *&ga
 
     // The game will start sending feedback!
     game->start();
-    cleanEmptyGames();
 
     return game_code;
 }
 
 bool GameManager::joinGame(Queue<std::shared_ptr<InGameCommand>> *&game_queue,
                            const std::shared_ptr<Queue<std::shared_ptr<Information>>> &player_queue,
-                           std::uint8_t *player_id, std::uint32_t game_code) {
+                           std::uint8_t *player_id, std::uint32_t game_code,
+                           const std::shared_ptr<SnapshotRate> &rate) {
     using std::unique_lock;
     using std::mutex;
 
@@ -124,22 +163,55 @@ bool GameManager::joinGame(Queue<std::shared_ptr<InGameCommand>> *&game_queue,
     unique_lock<mutex> lck(mtx);
 
     auto game = games.find(game_code);
-    if (game == games.end()) {
+    // lleno o terminado lo decide la partida bajo su lock, al unirlo
+    if (game == games.end() ||
+        !game->second->join(game_queue, player_queue, player_id, rate, make_shared<JoinGameFeedback>(JOINED))) {
         player_queue->push(make_shared<JoinGameFeedback>(NOT_JOINED));
         return false;
     }
-    
-    if (game->second->isFull()) {
-        player_queue->push(make_shared<JoinGameFeedback>(NOT_JOINED));
-        return false;
+    return true;
+}
+
+bool GameManager::joinOpenGame(Queue<std::shared_ptr<InGameCommand>> *&game_queue,
+                               const std::shared_ptr<Queue<std::shared_ptr<Information>>> &player_queue,
+                               std::uint8_t *player_id, uint8_t gameMode, uint8_t gameDifficulty,
+                               const std::shared_ptr<SnapshotRate> &rate) {
+    std::unique_lock<std::mutex> lck(mtx);
+    GameSummaryDTO open{};
+    while (lobby.fullest(gameMode, gameDifficulty, &open)) {
+        auto game = games.find(open.game_code);
+        // el indice puede tener una que termino recien: se saca y se prueba otra
+        if (game == games.end() ||
+            !game->second->join(game_queue, player_queue, player_id, rate,
+                                std::make_shared<JoinGameFeedback>(JOINED))) {
+            lobby.remove(open.game_code, gameMode, gameDifficulty);
+            continue;
+        }
+        return true;
     }
-    player_queue->push(make_shared<JoinGameFeedback>(JOINED));
+    return false;
+}
 
-    game->second->join(game_queue, player_queue, player_id);
-    return true;
+bool GameManager::quickMatch(Queue<std::shared_ptr<InGameCommand>> *&game_queue,
+                             const std::shared_ptr<Queue<std::shared_ptr<Information>>> &player_queue,
+                             std::uint8_t *player_id, uint8_t gameMode, uint8_t gameDifficulty,
+                             const std::shared_ptr<SnapshotRate> &rate) {
+    return matchmaker.match(gameMode, gameDifficulty, game_queue, player_queue, player_id, rate);
+}
+
+std::vector<GameSummaryDTO> GameManager::listGames(std::uint8_t mode, std::uint8_t difficulty) const {
+    return lobby.list(mode, difficulty, list_max);
 }
 
 
 GameManager::~GameManager() {
+    // nadie mas crea ni se une desde la partida rapida
+    matchmaker.stop();
+    {
+        std::unique_lock<std::mutex> lck(mtx);
+        stopping = true;
+    }
+    reap_cv.notify_one();
+    reaper.join();
     cleanAllGames();
 }
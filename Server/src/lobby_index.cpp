@@ -0,0 +1,78 @@
+#include <mutex>
+
+#include "../include/lobby_index.h"
+
+LobbyIndex::Bucket* LobbyIndex::bucketFor(std::uint8_t mode, std::uint8_t difficulty) {
+    if (mode >= MODES || difficulty >= DIFFICULTIES) return nullptr;
+    return &buckets[mode * DIFFICULTIES + difficulty];
+}
+
+const LobbyIndex::Bucket* LobbyIndex::bucketFor(std::uint8_t mode, std::uint8_t difficulty) const {
+    if (mode >= MODES || difficulty >= DIFFICULTIES) return nullptr;
+    return &buckets[mode * DIFFICULTIES + difficulty];
+}
+
+void LobbyIndex::collect(const Bucket &bucket, std::size_t max_results,
+                         std::vector<GameSummaryDTO> &result) const {
+    std::shared_lock<std::shared_mutex> lck(bucket.mtx);
+    for (auto game = bucket.open.begin(); game != bucket.open.end() && result.size() < max_results; ++game) {
+        result.push_back(game->second.summary);
+    }
+}
+
+void LobbyIndex::erase(Bucket &bucket, std::uint32_t game_code) {
+    auto open = bucket.open.find(game_code);
+    if (open == bucket.open.end()) return;
+    bucket.by_players.erase(open->second.rank);
+    bucket.open.erase(open);
+}
+
+void LobbyIndex::update(const GameSummaryDTO &game) {
+    Bucket* bucket = bucketFor(game.mode, game.difficulty);
+    if (!bucket) return;
+    std::unique_lock<std::shared_mutex> lck(bucket->mtx);
+    if (game.players >= game.max_players) {
+        erase(*bucket, game.game_code);
+        return;
+    }
+    auto open = bucket->open.find(game.game_code);
+    if (open == bucket->open.end()) {
+        auto rank = bucket->by_players.emplace(game.players, game.game_code);
+        bucket->open.emplace(game.game_code, OpenGame{game, rank});
+        return;
+    }
+    if (open->second.summary.players != game.players) {
+        bucket->by_players.erase(open->second.rank);
+        open->second.rank = bucket->by_players.emplace(game.players, game.game_code);
+    }
+    open->second.summary = game;
+}
+
+void LobbyIndex::remove(std::uint32_t game_code, std::uint8_t mode, std::uint8_t difficulty) {
+    Bucket* bucket = bucketFor(mode, difficulty);
+    if (!bucket) return;
+    std::unique_lock<std::shared_mutex> lck(bucket->mtx);
+    erase(*bucket, game_code);
+}
+
+std::vector<GameSummaryDTO> LobbyIndex::list(std::uint8_t mode, std::uint8_t difficulty,
+                                             std::size_t max_results) const {
+    std::vector<GameSummaryDTO> result;
+    for (std::size_t each_mode = 0; each_mode < MODES; each_mode++) {
+        if (mode != LOBBY_ANY && mode != each_mode) continue;
+        for (std::size_t each_difficulty = 0; each_difficulty < DIFFICULTIES; each_difficulty++) {
+            if (difficulty != LOBBY_ANY && difficulty != each_difficulty) continue;
+            collect(buckets[each_mode * DIFFICULTIES + each_difficulty], max_results, result);
+        }
+    }
+    return result;
+}
+
+bool LobbyIndex::fullest(std::uint8_t mode, std::uint8_t difficulty, GameSummaryDTO *game) const {
+    const Bucket* bucket = bucketFor(mode, difficulty);
+    if (!bucket) return false;
+    std::shared_lock<std::shared_mutex> lck(bucket->mtx);
+    if (bucket->by_players.empty()) return false;
+    *game = bucket->open.at(bucket->by_players.begin()->second).summary;
+    return true;
+}
@@ -0,0 +1,98 @@
+#include <algorithm>
+#include "../include/matchmaker.h"
+#include "../include/game_manager.h"
+
+Matchmaker::Matchmaker(GameManager &game_manager, std::size_t min_players, int max_wait_ms) :
+    game_manager(game_manager),
+    min_players(std::max<std::size_t>(1, min_players)),
+    max_wait(std::max(0, max_wait_ms)),
+    mtx(),
+    matched(),
+    waiting(),
+    placing(0),
+    waiters(0),
+    closed(false) {
+}
+
+void Matchmaker::place(Ticket &ticket, std::uint8_t mode, std::uint8_t difficulty) {
+    try {
+        // primero a la mas llena, la que se acaba de crear para el grupo tambien cuenta
+        ticket.joined = game_manager.joinOpenGame(ticket.game_queue, ticket.player_queue,
+                                                  &ticket.player_id, mode, difficulty, ticket.rate) ||
+                        game_manager.createGame(ticket.game_queue, ticket.player_queue,
+                                                &ticket.player_id, mode, difficulty, ticket.rate) != 0;
+    } catch (const ClosedQueue& e) {
+        // se desconecto mientras esperaba
+        ticket.joined = false;
+    }
+}
+
+void Matchmaker::dropDisconnected(std::vector<std::shared_ptr<Ticket>> &group) {
+    bool dropped = false;
+    for (auto ticket = group.begin(); ticket != group.end(); ) {
+        if ((*ticket)->player_queue->is_closed()) {
+            (*ticket)->taken = true;
+            (*ticket)->done = true;
+            ticket = group.erase(ticket);
+            dropped = true;
+        } else {
+            ++ticket;
+        }
+    }
+    if (dropped) matched.notify_all();
+}
+
+void Matchmaker::startGroup(std::unique_lock<std::mutex> &lck, std::vector<std::shared_ptr<Ticket>> &group,
+                            std::uint8_t mode, std::uint8_t difficulty) {
+    std::vector<std::shared_ptr<Ticket>> players;
+    players.swap(group);
+    for (auto& ticket : players) ticket->taken = true;
+    placing++;
+    // crear y unir toma el lock del GameManager: los demas pedidos no esperan
+    lck.unlock();
+    for (auto& ticket : players) place(*ticket, mode, difficulty);
+    lck.lock();
+    for (auto& ticket : players) ticket->done = true;
+    placing--;
+    matched.notify_all();
+}
+
+bool Matchmaker::match(std::uint8_t mode, std::uint8_t difficulty,
+                       Queue<std::shared_ptr<InGameCommand>> *&game_queue,
+                       const std::shared_ptr<Queue<std::shared_ptr<Information>>> &player_queue,
+                       std::uint8_t *player_id, const std::shared_ptr<SnapshotRate> &rate) {
+    std::unique_lock<std::mutex> lck(mtx);
+    if (closed) return false;
+    if (game_manager.joinOpenGame(game_queue, player_queue, player_id, mode, difficulty, rate)) {
+        return true;
+    }
+    auto ticket = std::make_shared<Ticket>(Ticket{player_queue, rate, nullptr, 0, false, false, false});
+    std::vector<std::shared_ptr<Ticket>>& group = waiting[mode * 256 + difficulty];
+    dropDisconnected(group);
+    group.push_back(ticket);
+    waiters++;
+    if (group.size() < min_players) {
+        matched.wait_for(lck, max_wait, [this, &ticket]() { return ticket->taken || closed; });
+    }
+    // se completo el grupo o nadie lo completo a tiempo: se arranca con los que hay
+    if (!ticket->taken && !closed) startGroup(lck, group, mode, difficulty);
+    if (!ticket->taken) {
+        // se freno el servidor mientras esperaba
+        group.erase(std::find(group.begin(), group.end(), ticket));
+    } else {
+        matched.wait(lck, [&ticket]() { return ticket->done; });
+    }
+    waiters--;
+    matched.notify_all();
+    if (!ticket->done) return false;
+    game_queue = ticket->game_queue;
+    *player_id = ticket->player_id;
+    return ticket->joined;
+}
+
+void Matchmaker::stop() {
+    std::unique_lock<std::mutex> lck(mtx);
+    closed = true;
+    matched.notify_all();
+    matched.wait(lck, [this]() { return placing == 0 && waiters == 0; });
+}
@@ -2,6 +2,9 @@
 #include "../include/protocol.h"
 #include "../include/Command/command_pregame_joingame.h"
 #include "../include/Command/command_pregame_creategame.h"
+#include "../include/Command/command_pregame_compression.h"
+#include "../include/Command/command_pregame_listgames.h"
+#include "../include/Command/command_pregame_quickmatch.h"
 #include "../include/Command/command_ingame_startshoot.h"
 #include "../include/Command/command_ingame_startexit.h"
 #include "../include/Command/command_ingame_startreload.h"
@@ -11,9 +14,28 @@
 #include "../include/Command/command_ingame_startidle.h"
 #include "../include/Command/command_ingame_startrevive.h"
 #include "../include/Command/command_ingame_pick_soldier.h"
+#include "../include/Command/command_ingame_viewhint.h"
 
 Protocol::Protocol(GameSocket &socket) : socket(socket) {}
 
+// REQUEST_SURVIVAL / REQUEST_CLEAR_THE_ZONE a GameMode, false si no es un modo
+static bool toGameMode(std::uint8_t request, std::uint8_t* mode) {
+    if (request == REQUEST_SURVIVAL) *mode = SURVIVAL;
+    else if (request == REQUEST_CLEAR_THE_ZONE) *mode = CLEAR_THE_ZONE;
+    else return false;
+    return true;
+}
+
+// REQUEST_EASY ... REQUEST_INSANE a GameDifficulty, false si no es una dificultad
+static bool toGameDifficulty(std::uint8_t request, std::uint8_t* difficulty) {
+    if (request == REQUEST_EASY) *difficulty = DEASY;
+    else if (request == REQUEST_NORMAL) *difficulty = DNORMAL;
+    else if (request == REQUEST_HARD) *difficulty = DHARD;
+    else if (request == REQUEST_INSANE) *difficulty = DINSANE;
+    else return false;
+    return true;
+}
+
 
 PreGameCommand *Protocol::recvPreGameCommand() {
     std::uint8_t action_id;
@@ -41,6 +63,30 @@ PreGameCommand *Protocol::recvPreGameCommand() {
             if (gamedif == REQUEST_HARD) return new CreateGameCommand(CLEAR_THE_ZONE, DHARD);
             if (gamedif == REQUEST_INSANE) return new CreateGameCommand(CLEAR_THE_ZONE, DINSANE);
         }
+    } else if (action_id == InformationID::REQUEST_COMPRESSION) {
+        uint8_t codec;
+        socket.recvData(&codec, 1);
+        return new CompressionCommand(codec);
+    } else if (action_id == InformationID::REQUEST_LIST_GAMES) {
+        uint8_t gamemode;
+        uint8_t gamedif;
+        socket.recvData(&gamemode, 1);
+        socket.recvData(&gamedif, 1);
+        // VOID = cualquiera
+        uint8_t mode = LOBBY_ANY;
+        uint8_t difficulty = LOBBY_ANY;
+        if (gamemode != VOID && !toGameMode(gamemode, &mode)) return nullptr;
+        if (gamedif != VOID && !toGameDifficulty(gamedif, &difficulty)) return nullptr;
+        return new ListGamesCommand(mode, difficulty);
+    } else if (action_id == InformationID::REQUEST_QUICK_MATCH) {
+        uint8_t gamemode;
+        uint8_t gamedif;
+        socket.recvData(&gamemode, 1);
+        socket.recvData(&gamedif, 1);
+        uint8_t mode;
+        uint8_t difficulty;
+        if (!toGameMode(gamemode, &mode) || !toGameDifficulty(gamedif, &difficulty)) return nullptr;
+        return new QuickMatchCommand(mode, difficulty);
     }
     return nullptr;
 }
@@ -119,6 +165,13 @@ InGameCommand* Protocol::recvInGameCommand(std::uint8_t player_id) {
         return new PickSoldierCommand(player_id, SOLDIER_IDF);
     } else if (action_id == REQUEST_PICK_SCOUT_SOLDIER) {
         return new PickSoldierCommand(player_id, SOLDIER_SCOUT);
+    } else if (action_id == ACTION_VIEW_HINT) {
+        std::uint32_t bigendian_window_x;
+        std::uint16_t bigendian_window_width;
+        socket.recvData(&bigendian_window_x, sizeof(bigendian_window_x));
+        socket.recvData(&bigendian_window_width, sizeof(bigendian_window_width));
+        auto window_x = static_cast<std::int32_t>(ntohl(bigendian_window_x));
+        return new ViewHintCommand(player_id, window_x, ntohs(bigendian_window_width));
     }
     return nullptr;
 }
@@ -4,7 +4,7 @@
 #include "../include/receiver.h"
 #include "../../Common/include/Information/information_code.h"
 
-Receiver::Receiver(GameSocket &&peer, GameManager& game_manager) :
+Receiver::Receiver(GameSocket &&peer, GameManager& game_manager, const SocketOptions& options) :
     peer(std::move(peer)),
     protocol(this->peer),
     send_state_queue(
@@ -17,7 +17,7 @@ Receiver::Receiver(GameSocket &&peer, GameManager& game_manager) :
     keep_talking(true),
     joined(false),
     player_id(0) {
-
+    this->peer.applyOptions(options);
 }
 
 // Excepcion si join falla (o nullptr). Excepcion: JoinFailed
@@ -41,7 +41,8 @@ void Receiver::joinGame() {
                                      "command.\n");
 
         joined = pregame_cmd->execute(game_manager, game_queue,
-                                      send_state_queue, &player_id);
+                                      send_state_queue, &player_id,
+                                      sender.snapshotRate());
 
     }
 }
@@ -58,6 +59,7 @@ void Receiver::readCommands() {
             throw std::runtime_error("Receiver::readCommands. Invalid ingame "
                                      "command.\n");
         }
+        peer.rearmQuickAck();
         game_queue->push(std::move(ingame_cmd));
     }
 }
@@ -69,7 +71,8 @@ void Receiver::run() {
     try {
     sender.start();
     joinGame();
-
+    // en partida los comandos son chicos y frecuentes
+    peer.setInGame(true);
     readCommands();
 
     } catch (const ClosedSocket& err) {
@@ -1,12 +1,204 @@
 // Copyright [2023] pgallino
 
+#include <cstring>
+#include <random>
+#include <netinet/in.h>
 #include "../include/sender.h"
+#include "../../Common/include/Information/information_code.h"
+#include "../../Common/include/Information/feedback_server_joingame.h"
+#include "../../Common/include/Information/feedback_server_datagramoffer.h"
+#include "../../Common/include/Information/feedback_server_gamestate.h"
+#include "yaml-cpp/yaml.h"
+
+// seq de 4 bytes antes del snapshot
+constexpr std::size_t DATAGRAM_HEADER = 4;
+// id, largo comprimido y largo original
+constexpr std::size_t COMPRESSED_HEADER = 9;
+// si el kernel tarda en soltar buffers se deja de usar zero copy
+constexpr std::size_t MAX_IN_FLIGHT = 64;
 
 Sender::Sender(GameSocket& socket, Queue<std::shared_ptr<Information>>& game_state_queue) :
     protocol(socket),
+    socket(socket),
     game_state_queue(game_state_queue),
+    pool(),
+    pending(),
+    iovecs(),
+    in_flight(),
+    rate(nullptr),
+    measure_every(0),
+    last_measure(),
     is_running(true) ,
-    keep_talking(true) {
+    keep_talking(true),
+    datagram(nullptr),
+    datagram_token(0),
+    datagram_sequence(0),
+    datagram_ready(false),
+    datagram_buffer(),
+    deflater(nullptr) {
+    YAML::Node config = YAML::LoadFile(SERVER_CONFIG_PATH "/config.yaml");
+    compact_state = config["snapshot"]["compact"].as<bool>();
+    YAML::Node send = config["send"];
+    pool.configure(send["buffer_capacity"].as<std::size_t>(),
+                   send["pooled_buffers"].as<std::size_t>());
+    batch_max = send["batch_max"].as<std::size_t>();
+    zerocopy_min_bytes = send["zerocopy_min_bytes"].as<std::size_t>();
+    // si el kernel no lo soporta se sigue copiando
+    zerocopy_enabled = send["zerocopy"].as<bool>() && socket.enableZeroCopy();
+    YAML::Node rate_config = config["rate"];
+    rate = std::make_shared<SnapshotRate>(rate_config["max_stride"].as<std::uint32_t>(),
+                                          rate_config["backlog_high"].as<std::size_t>(),
+                                          rate_config["rtt_high_ms"].as<std::uint32_t>() * 1000,
+                                          rate_config["max_pending"].as<std::int32_t>(),
+                                          rate_config["recover_after"].as<std::uint32_t>());
+    measure_every = std::chrono::milliseconds(rate_config["measure_ms"].as<int>());
+    YAML::Node compression = config["compression"];
+    compression_enabled = compression["enabled"].as<bool>();
+    compression_min_bytes = compression["min_bytes"].as<std::size_t>();
+    compression_level = compression["level"].as<int>();
+    YAML::Node udp = config["udp"];
+    datagram_enabled = udp["enabled"].as<bool>();
+    max_datagram = udp["max_datagram"].as<std::size_t>();
+    datagram_loss = udp["simulated_loss"].as<double>();
+}
+
+void Sender::offerDatagramChannel() {
+    if (!datagram_enabled || datagram) return;
+    datagram.reset(new DatagramSocket("0"));
+    datagram->setLoss(datagram_loss);
+    std::random_device rd;
+    datagram_token = rd();
+    protocol.sendFeedback(DatagramOfferFeedback(datagram->localPort(), datagram_token));
+}
+
+void Sender::serializeFeedInto(const Information& feed, std::vector<std::int8_t>& result) const {
+    if (compact_state && feed.get_type() == FEEDBACK_GAME_STATE) {
+        static_cast<const GameStateFeedback&>(feed).serializeCompactInto(result);
+        return;
+    }
+    feed.serializeInto(result);
+}
+
+void Sender::answerCompression(const CompressionFeedback& request) {
+    std::uint8_t codec = (compression_enabled && request.codec == COMPRESSION_DEFLATE) ?
+            COMPRESSION_DEFLATE : COMPRESSION_NONE;
+    Buffer buffer = pool.acquire();
+    CompressionFeedback(codec).serializeInto(*buffer);
+    pending.push_back(std::move(buffer));
+    if (codec == COMPRESSION_DEFLATE && !deflater) {
+        deflater.reset(new FrameDeflater(compression_level));
+    }
+}
+
+Sender::Buffer Sender::compressFrame(Buffer raw) {
+    Buffer framed = pool.acquire();
+    framed->resize(COMPRESSED_HEADER);
+    deflater->compress(raw->data(), raw->size(), *framed);
+
+    std::uint32_t bigendian_compressed = htonl(framed->size() - COMPRESSED_HEADER);
+    std::uint32_t bigendian_raw = htonl(raw->size());
+    (*framed)[0] = static_cast<std::int8_t>(FEEDBACK_COMPRESSED);
+    std::memcpy(framed->data() + 1, &bigendian_compressed, sizeof(bigendian_compressed));
+    std::memcpy(framed->data() + 5, &bigendian_raw, sizeof(bigendian_raw));
+    pool.release(std::move(raw));
+    return framed;
+}
+
+bool Sender::queueFeed(const Information& feed) {
+    if (feed.get_type() == FEEDBACK_GAME_STATE) rate->dequeued();
+    if (feed.get_type() == FEEDBACK_COMPRESSION) {
+        answerCompression(static_cast<const CompressionFeedback&>(feed));
+        return false;
+    }
+    Buffer buffer = pool.acquire();
+    serializeFeedInto(feed, *buffer);
+    if (feed.get_type() == FEEDBACK_GAME_STATE && sendByDatagram(*buffer)) {
+        pool.release(std::move(buffer));
+        return false;
+    }
+    // por UDP no: el stream comprimido necesita que lleguen todos y en orden
+    if (deflater && buffer->size() >= compression_min_bytes) {
+        buffer = compressFrame(std::move(buffer));
+    }
+    pending.push_back(std::move(buffer));
+    // recien unido a una partida: se negocia el canal UDP
+    return feed.get_type() == FEEDBACK_CREATE_GAME ||
+           (feed.get_type() == FEEDBACK_JOIN_GAME &&
+            static_cast<const JoinGameFeedback&>(feed).joined == JOINED);
+}
+
+void Sender::flush() {
+    if (pending.empty()) return;
+    reclaimZeroCopy();
+
+    std::size_t total = 0;
+    iovecs.clear();
+    for (const Buffer& buffer : pending) {
+        iovecs.push_back({buffer->data(), buffer->size()});
+        total += buffer->size();
+    }
+    bool zerocopy = zerocopy_enabled && total >= zerocopy_min_bytes &&
+                    in_flight.size() < MAX_IN_FLIGHT;
+    bool sent_zerocopy = socket.sendBuffers(iovecs.data(), iovecs.size(), zerocopy);
+    if (sent_zerocopy) {
+        in_flight.emplace_back(socket.zeroCopySent(), std::move(pending));
+        pending.clear();
+        return;
+    }
+    for (Buffer& buffer : pending) {
+        pool.release(std::move(buffer));
+    }
+    pending.clear();
+}
+
+void Sender::measureLink() {
+    auto now = std::chrono::steady_clock::now();
+    if (now - last_measure < measure_every) return;
+    last_measure = now;
+    rate->report(socket.pendingOutput(), socket.roundTripMicros());
+}
+
+void Sender::reclaimZeroCopy() {
+    if (in_flight.empty()) return;
+    std::uint32_t done = socket.reapZeroCopy();
+    while (!in_flight.empty() && static_cast<std::int32_t>(done - in_flight.front().first) >= 0) {
+        for (Buffer& buffer : in_flight.front().second) {
+            pool.release(std::move(buffer));
+        }
+        in_flight.pop_front();
+    }
+}
+
+bool Sender::tryPopQueued(std::shared_ptr<Information>& feed) {
+    try {
+        return game_state_queue.try_pop(feed);
+    } catch (const ClosedQueue& err) {
+        return false;
+    }
+}
+
+bool Sender::sendByDatagram(const std::vector<std::int8_t>& serialized) {
+    if (!datagram) return false;
+    if (!datagram_ready) {
+        // el cliente acepta mandando el token desde su puerto UDP
+        std::uint32_t bigendian_token;
+        while (datagram->recvDatagram(&bigendian_token, sizeof(bigendian_token), 0) == sizeof(bigendian_token)) {
+            if (ntohl(bigendian_token) != datagram_token) continue;
+            datagram->connectToLastPeer();
+            datagram_ready = true;
+            break;
+        }
+        if (!datagram_ready) return false;
+    }
+    // si no entra en un datagrama va por TCP, el cliente lo toma igual
+    if (serialized.size() + DATAGRAM_HEADER > max_datagram) return false;
+
+    std::uint32_t bigendian_sequence = htonl(++datagram_sequence);
+    datagram_buffer.resize(DATAGRAM_HEADER);
+    std::memcpy(datagram_buffer.data(), &bigendian_sequence, DATAGRAM_HEADER);
+    datagram_buffer.insert(datagram_buffer.end(), serialized.begin(), serialized.end());
+    datagram->sendDatagram(datagram_buffer.data(), datagram_buffer.size());
+    return true;
 }
 
 void Sender::run() {
@@ -14,25 +206,59 @@ void Sender::run() {
     using std::endl;
     try {
     while (keep_talking) {
-        const std::shared_ptr<Information>& feed = game_state_queue.pop();
-        protocol.sendFeedback(*feed);
+        std::shared_ptr<Information> feed = game_state_queue.pop();
+        bool offer = false;
+        // lo que ya esta encolado sale junto, en una sola llamada
+        do {
+            offer |= queueFeed(*feed);
+        } while (pending.size() < batch_max && tryPopQueued(feed));
+        flush();
+        measureLink();
+        if (offer) offerDatagramChannel();
     }
     } catch (const ClosedQueue& err) {
         cerr << "In Sender thread: " << err.what() << endl;
         is_running = false;
         keep_talking = false;
+    } catch (const ClosedSocket& err) {
+        // se fue o no lee (vencio el envio): hay que sacarlo de todos lados
+        cerr << "In Sender thread: " << err.what() << endl;
+        disconnect();
     } catch (const std::exception& e) {
         cerr << "An exception was caught in the Sender thread: "
         << e.what() << endl;
+        disconnect();
     } catch (...) {
         cerr << "An unknown exception was caught in the Sender thread." << endl;
+        disconnect();
     }
     is_running = false;
 }
 
+void Sender::disconnect() {
+    if (!keep_talking)
+        return;  // stop() ya lo esta sacando
+    keep_talking = false;
+    // el Receiver sale de su recv y la partida lo saca al ver la cola cerrada
+    socket._shutdown(SHUT_RDWR);
+    try {
+        game_state_queue.close();
+    } catch (const std::runtime_error& e) {
+        // ya la habia cerrado stop()
+    }
+}
+
 void Sender::stop() {
     keep_talking = false;
-    game_state_queue.close();
+    try {
+        game_state_queue.close();
+    } catch (const std::runtime_error& e) {
+        // ya la habia cerrado disconnect()
+    }
+}
+
+const std::shared_ptr<SnapshotRate>& Sender::snapshotRate() const {
+    return rate;
 }
 
 bool Sender::isDead() const {
@@ -1,12 +1,30 @@
+#include <algorithm>
 #include "../include/server.h"
 
-Server::Server(const std::string& servname) : accepter(servname) {}
+Server::Server(const std::string& servname) :
+    config(YAML::LoadFile(SERVER_CONFIG_PATH "/config.yaml")),
+    game_manager(config["admission"]["max_games"].as<std::size_t>(),
+                 config["lobby"]["reap_ms"].as<int>(),
+                 config["lobby"]["list_max"].as<std::size_t>(),
+                 config["matchmaking"]["min_players"].as<std::size_t>(),
+                 config["matchmaking"]["wait_ms"].as<int>()),
+    admission(config["admission"]["max_connections"].as<std::size_t>()),
+    accepters() {
+    int amount = std::max(1, config["admission"]["accepters"].as<int>());
+    int backlog = config["admission"]["backlog"].as<int>();
+    int reap_ms = config["admission"]["reap_ms"].as<int>();
+    // con mas de uno cada Accepter tiene su socket y el kernel reparte
+    for (int number = 0; number < amount; number++) {
+        accepters.emplace_back(new Accepter(servname, backlog, amount > 1, reap_ms,
+                                            game_manager, admission));
+    }
+}
 
 void Server::init() {
     using std::string;
     using std::cin;
 
-    accepter.start();
+    for (auto& accepter : accepters) accepter->start();
     string input;
     do {
         getline(cin, input);
@@ -14,6 +32,6 @@ void Server::init() {
 }
 
 Server::~Server() {
-    accepter.stop();
-    accepter.join();
+    for (auto& accepter : accepters) accepter->stop();
+    for (auto& accepter : accepters) accepter->join();
 }
@@ -0,0 +1,55 @@
+#include <algorithm>
+#include "../include/snapshot_rate.h"
+
+SnapshotRate::SnapshotRate(std::uint32_t max_stride, std::size_t backlog_high, std::uint32_t rtt_high_us,
+                           std::int32_t max_pending, std::uint32_t recover_after) :
+    max_stride(std::max<std::uint32_t>(max_stride, 1)),
+    backlog_high(backlog_high),
+    rtt_high_us(rtt_high_us),
+    max_pending(max_pending),
+    recover_after(recover_after),
+    stride(1),
+    pending(0),
+    tick(0),
+    clear_reports(0) {
+}
+
+bool SnapshotRate::shouldSend() {
+    ++tick;
+    if (pending.load() >= max_pending) return false;
+    return tick % stride.load() == 0;
+}
+
+void SnapshotRate::enqueued() {
+    ++pending;
+}
+
+void SnapshotRate::dropped() {
+    --pending;
+}
+
+void SnapshotRate::dequeued() {
+    --pending;
+}
+
+void SnapshotRate::report(std::size_t backlog_bytes, std::uint32_t rtt_us) {
+    bool congested = backlog_bytes > backlog_high || rtt_us > rtt_high_us;
+    if (congested) {
+        // baja rapido: se duplica el paso
+        stride = std::min(stride.load() * 2, max_stride);
+        clear_reports = 0;
+        return;
+    }
+    // sube despacio: un paso menos cada recover_after reportes limpios
+    if (++clear_reports < recover_after) return;
+    clear_reports = 0;
+    if (stride.load() > 1) --stride;
+}
+
+std::uint32_t SnapshotRate::getStride() const {
+    return stride;
+}
+
+std::int32_t SnapshotRate::getPending() const {
+    return pending;
+}
@@ -144,6 +144,11 @@ class Queue {
             is_not_empty.notify_all();
         }
 
+        bool is_closed() {
+            std::unique_lock<std::mutex> lck(mtx);
+            return closed;
+        }
+
     private:
         Queue(const Queue&) = delete;
         Queue& operator=(const Queue&) = delete;
@@ -0,0 +1,119 @@
+#include <benchmark/benchmark.h>
+#include "GameLogic/position.h"
+#include "GameLogic/vec2.h"
+
+#include <cmath>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#define MAP_DIM_X 50000
+#define MAP_DIM_Y 200
+#define ENTITIES 2048
+
+// Version anterior de Position::collides (tuplas y complementos), para comparar.
+static bool legacyCollides(const Position &pos, const Position &other) {
+    std::tuple<double, double, bool> area_other_x = other.getXArea();
+    std::tuple<double, double, bool> area_other_y = other.getYArea();
+    std::tuple<double, double, bool> area_x = pos.getXArea();
+    std::tuple<double, double, bool> area_y = pos.getYArea();
+    double x_min_other = std::get<0>(area_other_x);
+    double x_max_other = std::get<1>(area_other_x);
+    double x_min = std::get<0>(area_x);
+    double x_max = std::get<1>(area_x);
+    bool hits_x = false;
+    if (!std::get<2>(area_other_x) && !std::get<2>(area_x)) {
+        hits_x = true;
+    } else if (std::get<2>(area_other_x) && !std::get<2>(area_x)) {
+        hits_x = !(((x_min <= x_max_other) && (x_max_other <= x_max)) || ((x_min <= x_min_other) && (x_min_other <= x_max)));
+    } else if (!std::get<2>(area_other_x) && std::get<2>(area_x)) {
+        hits_x = (((x_min_other <= x_max) && (x_max <= x_max_other)) || ((x_min_other <= x_min) && (x_min <= x_max_other)));
+    } else {
+        hits_x = (((x_min <= x_max_other) && (x_max_other <= x_max)) || ((x_min <= x_min_other) && (x_min_other <= x_max)));
+    }
+    double y_min_other = std::get<0>(area_other_y);
+    double y_max_other = std::get<1>(area_other_y);
+    double y_min = std::get<0>(area_y);
+    double y_max = std::get<1>(area_y);
+    bool hits_y = (((y_min <= y_max_other) && (y_max_other <= y_max)) || ((y_min <= y_min_other) && (y_min_other <= y_max)));
+    return (hits_x && hits_y);
+}
+
+static std::vector<Position> randomPositions(void) {
+    std::mt19937 mt(42);
+    std::uniform_real_distribution<double> distx(0, MAP_DIM_X);
+    std::uniform_real_distribution<double> disty(0, MAP_DIM_Y);
+    std::vector<Position> positions;
+    for (int i = 0; i < ENTITIES; i++) {
+        positions.emplace_back(distx(mt), disty(mt), 20, 40, MAP_DIM_X, MAP_DIM_Y);
+    }
+    return positions;
+}
+
+static void BM_LegacyCollides(benchmark::State& state) {
+    std::vector<Position> positions = randomPositions();
+    Position mover(MAP_DIM_X * 0.5, MAP_DIM_Y * 0.5, 20, 40, MAP_DIM_X, MAP_DIM_Y);
+    for (auto _ : state) {
+        size_t hits = 0;
+        for (const Position &other : positions) hits += legacyCollides(mover, other);
+        benchmark::DoNotOptimize(hits);
+    }
+    state.SetItemsProcessed(state.iterations() * positions.size());
+}
+BENCHMARK(BM_LegacyCollides);
+
+static void BM_Collides(benchmark::State& state) {
+    std::vector<Position> positions = randomPositions();
+    Position mover(MAP_DIM_X * 0.5, MAP_DIM_Y * 0.5, 20, 40, MAP_DIM_X, MAP_DIM_Y);
+    for (auto _ : state) {
+        size_t hits = 0;
+        for (const Position &other : positions) hits += mover.collides(other);
+        benchmark::DoNotOptimize(hits);
+    }
+    state.SetItemsProcessed(state.iterations() * positions.size());
+}
+BENCHMARK(BM_Collides);
+
+static void BM_CollidesBatch(benchmark::State& state) {
+    std::vector<Position> positions = randomPositions();
+    std::vector<Aabb> boxes;
+    for (const Position &other : positions) boxes.push_back(other.getAabb());
+    std::vector<uint8_t> hits(boxes.size());
+    Position mover(MAP_DIM_X * 0.5, MAP_DIM_Y * 0.5, 20, 40, MAP_DIM_X, MAP_DIM_Y);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(mover.collides(boxes.data(), boxes.size(), hits.data()));
+    }
+    state.SetItemsProcessed(state.iterations() * boxes.size());
+}
+BENCHMARK(BM_CollidesBatch);
+
+// Deteccion como estaba antes: raiz de potencias para comparar contra el rango.
+static void BM_LegacyInRange(benchmark::State& state) {
+    std::vector<Position> positions = randomPositions();
+    Position mover(MAP_DIM_X * 0.5, MAP_DIM_Y * 0.5, 20, 40, MAP_DIM_X, MAP_DIM_Y);
+    for (auto _ : state) {
+        size_t seen = 0;
+        for (const Position &other : positions) {
+            double distance = std::sqrt(std::pow(std::abs(mover.getXPos() - other.getXPos()), 2)
+                + std::pow(std::abs(mover.getYPos() - other.getYPos()), 2));
+            seen += (distance <= 500);
+        }
+        benchmark::DoNotOptimize(seen);
+    }
+    state.SetItemsProcessed(state.iterations() * positions.size());
+}
+BENCHMARK(BM_LegacyInRange);
+
+static void BM_InRangeSq(benchmark::State& state) {
+    std::vector<Position> positions = randomPositions();
+    Position mover(MAP_DIM_X * 0.5, MAP_DIM_Y * 0.5, 20, 40, MAP_DIM_X, MAP_DIM_Y);
+    for (auto _ : state) {
+        size_t seen = 0;
+        for (const Position &other : positions) seen += (distanceSq(mover, other) <= 500 * 500);
+        benchmark::DoNotOptimize(seen);
+    }
+    state.SetItemsProcessed(state.iterations() * positions.size());
+}
+BENCHMARK(BM_InRangeSq);
+
+BENCHMARK_MAIN();
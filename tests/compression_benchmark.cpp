@@ -0,0 +1,104 @@
+#include <benchmark/benchmark.h>
+#include "Socket/frame_compression.h"
+#include "Information/feedback_server_gamestate.h"
+#include "Information/information_code.h"
+
+#include <random>
+#include <vector>
+
+// CPU de comprimir contra bytes ahorrados sobre una partida grabada: una
+// horda que avanza unos pocos pixeles por tick y cambia de accion cada tanto.
+// range(0): nivel de deflate. range(1): 1 = formato compacto, 0 = el de siempre.
+#define RECORDED_TICKS 200
+#define HORDE_SIZE 400
+
+static std::vector<std::vector<std::int8_t>> record(bool compact) {
+    std::mt19937 rng(1234);
+    std::vector<int> x(HORDE_SIZE);
+    std::vector<std::uint8_t> action(HORDE_SIZE, ZOMBIE_WALK);
+    for (int id = 0; id < HORDE_SIZE; id++) x[id] = 2000 + id * 5;
+
+    std::vector<std::vector<std::int8_t>> ticks;
+    for (int tick = 0; tick < RECORDED_TICKS; tick++) {
+        std::vector<std::pair<std::uint16_t, ElementStateDTO>> elements;
+        for (int id = 0; id < HORDE_SIZE; id++) {
+            x[id] -= 1 + rng() % 3;
+            if (rng() % 20 == 0) action[id] = rng() % (ZOMBIE_WALK + 1);
+            elements.emplace_back(id, ElementStateDTO{ZOMBIE, action[id], -1, x[id],
+                                                      static_cast<int>(id % 180), 100,
+                                                      static_cast<std::uint16_t>(60 + id % 40),
+                                                      0, 0, 0, 0});
+        }
+        GameStateFeedback state(std::move(elements));
+        ticks.push_back(compact ? state.serializeCompact() : state.serialize());
+    }
+    return ticks;
+}
+
+static void reportBytes(benchmark::State& state, std::size_t raw, std::size_t compressed) {
+    state.SetBytesProcessed(static_cast<std::int64_t>(raw));
+    state.counters["ratio"] = static_cast<double>(raw) / compressed;
+    state.counters["bytes/tick"] = static_cast<double>(compressed) / (state.iterations() * RECORDED_TICKS);
+}
+
+// Un stream por conexion: cada tick se apoya en los anteriores.
+static void BM_DeflateStream(benchmark::State& state) {
+    std::vector<std::vector<std::int8_t>> ticks = record(state.range(1));
+    std::vector<std::int8_t> out;
+    std::size_t raw = 0;
+    std::size_t compressed = 0;
+    for (auto _ : state) {
+        FrameDeflater deflater(state.range(0));
+        for (const auto& tick : ticks) {
+            out.clear();
+            deflater.compress(tick.data(), tick.size(), out);
+            raw += tick.size();
+            compressed += out.size();
+        }
+    }
+    reportBytes(state, raw, compressed);
+}
+
+// Cada tick comprimido solo, sin contexto (lo que pasaria con un codec por mensaje).
+static void BM_DeflatePerFrame(benchmark::State& state) {
+    std::vector<std::vector<std::int8_t>> ticks = record(state.range(1));
+    std::vector<std::int8_t> out;
+    std::size_t raw = 0;
+    std::size_t compressed = 0;
+    for (auto _ : state) {
+        for (const auto& tick : ticks) {
+            FrameDeflater deflater(state.range(0));
+            out.clear();
+            deflater.compress(tick.data(), tick.size(), out);
+            raw += tick.size();
+            compressed += out.size();
+        }
+    }
+    reportBytes(state, raw, compressed);
+}
+
+// Lo que le cuesta al cliente descomprimir la partida.
+static void BM_InflateStream(benchmark::State& state) {
+    std::vector<std::vector<std::int8_t>> ticks = record(state.range(1));
+    std::vector<std::vector<std::int8_t>> frames(ticks.size());
+    FrameDeflater deflater(state.range(0));
+    for (std::size_t tick = 0; tick < ticks.size(); tick++) {
+        deflater.compress(ticks[tick].data(), ticks[tick].size(), frames[tick]);
+    }
+    std::vector<std::int8_t> restored;
+    std::size_t raw = 0;
+    for (auto _ : state) {
+        FrameInflater inflater;
+        for (std::size_t tick = 0; tick < ticks.size(); tick++) {
+            inflater.decompress(frames[tick].data(), frames[tick].size(), ticks[tick].size(), restored);
+            raw += ticks[tick].size();
+        }
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(raw));
+}
+
+BENCHMARK(BM_DeflateStream)->ArgsProduct({{1, 6}, {0, 1}})->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_DeflatePerFrame)->ArgsProduct({{1, 6}, {0, 1}})->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_InflateStream)->ArgsProduct({{1}, {0, 1}})->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -1,7 +1,14 @@
 #include <gtest/gtest.h>
 #include <chrono>
 #include <limits>
+#include <memory>
 #include "game_manager.h"
+#include "snapshot_rate.h"
+#include "admission.h"
+#include "lobby_index.h"
+#include "Information/feedback_server_full.h"
+#include "Information/feedback_server_joingame.h"
+#include <thread>
 #include "Command/command_ingame_startshoot.h"
 #include "Command/command_ingame_startrevive.h"
 #include "Command/command_ingame_startmove.h"
@@ -355,7 +362,343 @@ TEST(gamemanager_test,
     EXPECT_GT(new_x, old_x);
 }
 
+TEST(gamemanager_test, AdmissionTest00GamesOverTheCapAreRefusedWithServerFull) {
+    Queue<std::shared_ptr<InGameCommand>>* game_q = nullptr;
+    std::shared_ptr<Queue<std::shared_ptr<Information>>> player_q =
+            std::make_shared<Queue<std::shared_ptr<Information>>>(10000);
+    std::uint8_t player_id = 0;
+    GameManager manager(1);
+
+    ASSERT_NE(manager.createGame(game_q, player_q, &player_id, SURVIVAL, DEASY), 0u);
+    player_q->pop();
+
+    Queue<std::shared_ptr<InGameCommand>>* other_game_q = nullptr;
+    std::shared_ptr<Queue<std::shared_ptr<Information>>> other_player_q =
+            std::make_shared<Queue<std::shared_ptr<Information>>>(10000);
+    EXPECT_EQ(manager.createGame(other_game_q, other_player_q, &player_id, SURVIVAL, DEASY), 0u);
+    EXPECT_EQ(other_game_q, nullptr);
+    std::shared_ptr<Information> feed = other_player_q->pop();
+    ASSERT_EQ(feed->get_type(), FEEDBACK_SERVER_FULL);
+    EXPECT_EQ(static_cast<ServerFullFeedback&>(*feed).reason, FULL_GAMES);
+}
+
+TEST(gamemanager_test, LobbyTest00OpenGamesAreListedByModeAndDifficulty) {
+    std::uint8_t player_id = 0;
+    GameManager manager;
+    Queue<std::shared_ptr<InGameCommand>>* game_q = nullptr;
+    std::shared_ptr<Queue<std::shared_ptr<Information>>> player_q =
+            std::make_shared<Queue<std::shared_ptr<Information>>>(10000);
+    Queue<std::shared_ptr<InGameCommand>>* other_game_q = nullptr;
+    std::shared_ptr<Queue<std::shared_ptr<Information>>> other_player_q =
+            std::make_shared<Queue<std::shared_ptr<Information>>>(10000);
+
+    std::uint32_t survival = manager.createGame(game_q, player_q, &player_id, SURVIVAL, DEASY);
+    std::uint32_t clear = manager.createGame(other_game_q, other_player_q, &player_id, CLEAR_THE_ZONE, DHARD);
+
+    std::vector<GameSummaryDTO> easy_survival = manager.listGames(SURVIVAL, DEASY);
+    ASSERT_EQ(easy_survival.size(), 1u);
+    EXPECT_EQ(easy_survival.at(0).game_code, survival);
+    EXPECT_EQ(easy_survival.at(0).players, 1);
+    EXPECT_TRUE(manager.listGames(SURVIVAL, DHARD).empty());
+    EXPECT_EQ(manager.listGames(CLEAR_THE_ZONE, LOBBY_ANY).at(0).game_code, clear);
+    EXPECT_EQ(manager.listGames(LOBBY_ANY, LOBBY_ANY).size(), 2u);
+
+    Queue<std::shared_ptr<InGameCommand>>* joined_game_q = nullptr;
+    std::shared_ptr<Queue<std::shared_ptr<Information>>> joined_player_q =
+            std::make_shared<Queue<std::shared_ptr<Information>>>(10000);
+    ASSERT_TRUE(manager.joinGame(joined_game_q, joined_player_q, &player_id, survival));
+    EXPECT_EQ(manager.listGames(SURVIVAL, DEASY).at(0).players, 2);
+}
+
+TEST(gamemanager_test, LobbyTest01FullGamesLeaveTheIndex) {
+    LobbyIndex lobby;
+
+    lobby.update(GameSummaryDTO{1234567, SURVIVAL, DNORMAL, 9, 10});
+    lobby.update(GameSummaryDTO{7654321, SURVIVAL, DNORMAL, 3, 10});
+    EXPECT_EQ(lobby.list(SURVIVAL, DNORMAL, 10).size(), 2u);
+    EXPECT_EQ(lobby.list(SURVIVAL, DNORMAL, 1).size(), 1u);
+
+    lobby.update(GameSummaryDTO{1234567, SURVIVAL, DNORMAL, 10, 10});
+    std::vector<GameSummaryDTO> open = lobby.list(LOBBY_ANY, LOBBY_ANY, 10);
+    ASSERT_EQ(open.size(), 1u);
+    EXPECT_EQ(open.at(0).game_code, 7654321u);
+
+    lobby.remove(7654321, SURVIVAL, DNORMAL);
+    EXPECT_TRUE(lobby.list(LOBBY_ANY, LOBBY_ANY, 10).empty());
+}
+
+TEST(gamemanager_test, LobbyTest02AbandonedGamesAreReapedAndFreeTheirSlot) {
+    std::uint8_t player_id = 0;
+    GameManager manager(1, 10);
+    Queue<std::shared_ptr<InGameCommand>>* game_q = nullptr;
+    std::shared_ptr<Queue<std::shared_ptr<Information>>> player_q =
+            std::make_shared<Queue<std::shared_ptr<Information>>>(10000);
+    ASSERT_NE(manager.createGame(game_q, player_q, &player_id, SURVIVAL, DEASY), 0u);
+
+    // el jugador se va: su Sender cierra la cola y el Receiver la suelta
+    player_q->close();
+    player_q.reset();
+    for (int tries = 0; tries < 200 && !manager.listGames(LOBBY_ANY, LOBBY_ANY).empty(); tries++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    EXPECT_TRUE(manager.listGames(LOBBY_ANY, LOBBY_ANY).empty());
+
+    Queue<std::shared_ptr<InGameCommand>>* other_game_q = nullptr;
+    std::shared_ptr<Queue<std::shared_ptr<Information>>> other_player_q =
+            std::make_shared<Queue<std::shared_ptr<Information>>>(10000);
+    EXPECT_NE(manager.createGame(other_game_q, other_player_q, &player_id, SURVIVAL, DEASY), 0u);
+}
+
+TEST(gamemanager_test, LobbyTest03LeavingPlayersAndFinishedGamesUpdateTheIndexRightAway) {
+    std::uint8_t player_id = 0;
+    // el reaper no llega a correr: el indice lo actualiza la partida
+    GameManager manager(10, 60000);
+    Queue<std::shared_ptr<InGameCommand>>* game_q = nullptr;
+    std::shared_ptr<Queue<std::shared_ptr<Information>>> player_q =
+            std::make_shared<Queue<std::shared_ptr<Information>>>(10000);
+    std::uint32_t code = manager.createGame(game_q, player_q, &player_id, SURVIVAL, DEASY);
+    Queue<std::shared_ptr<InGameCommand>>* joined_game_q = nullptr;
+    std::shared_ptr<Queue<std::shared_ptr<Information>>> joined_player_q =
+            std::make_shared<Queue<std::shared_ptr<Information>>>(10000);
+    ASSERT_TRUE(manager.joinGame(joined_game_q, joined_player_q, &player_id, code));
+    // la confirmacion llega antes que cualquier snapshot
+    EXPECT_EQ(joined_player_q->pop()->get_type(), FEEDBACK_JOIN_GAME);
+    EXPECT_EQ(manager.listGames(SURVIVAL, DEASY).at(0).players, 2);
+
+    joined_player_q->close();
+    for (int tries = 0; tries < 200 && manager.listGames(SURVIVAL, DEASY).at(0).players != 1; tries++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    EXPECT_EQ(manager.listGames(SURVIVAL, DEASY).at(0).players, 1);
+
+    player_q->close();
+    for (int tries = 0; tries < 200 && !manager.listGames(LOBBY_ANY, LOBBY_ANY).empty(); tries++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    EXPECT_TRUE(manager.listGames(LOBBY_ANY, LOBBY_ANY).empty());
+
+    // sigue en games hasta que pase el reaper, pero ya no acepta a nadie
+    std::shared_ptr<Queue<std::shared_ptr<Information>>> late_player_q =
+            std::make_shared<Queue<std::shared_ptr<Information>>>(10000);
+    EXPECT_FALSE(manager.joinGame(joined_game_q, late_player_q, &player_id, code));
+    auto answer = std::dynamic_pointer_cast<JoinGameFeedback>(late_player_q->pop());
+    ASSERT_NE(answer, nullptr);
+    EXPECT_EQ(answer->joined, NOT_JOINED);
+}
+
+TEST(gamemanager_test, QuickMatchTest00PlayersArePackedIntoTheFullestOpenGame) {
+    std::uint8_t player_id = 0;
+    GameManager manager;
+    Queue<std::shared_ptr<InGameCommand>>* game_q = nullptr;
+    std::shared_ptr<Queue<std::shared_ptr<Information>>> player_q =
+            std::make_shared<Queue<std::shared_ptr<Information>>>(10000);
+    Queue<std::shared_ptr<InGameCommand>>* other_game_q = nullptr;
+    std::shared_ptr<Queue<std::shared_ptr<Information>>> other_player_q =
+            std::make_shared<Queue<std::shared_ptr<Information>>>(10000);
+    std::uint32_t emptier = manager.createGame(game_q, player_q, &player_id, SURVIVAL, DHARD);
+    std::uint32_t fuller = manager.createGame(other_game_q, other_player_q, &player_id, SURVIVAL, DHARD);
+    ASSERT_TRUE(manager.joinGame(other_game_q, other_player_q, &player_id, fuller));
+    ASSERT_NE(emptier, fuller);
+
+    Queue<std::shared_ptr<InGameCommand>>* quick_game_q = nullptr;
+    std::shared_ptr<Queue<std::shared_ptr<Information>>> quick_player_q =
+            std::make_shared<Queue<std::shared_ptr<Information>>>(10000);
+    ASSERT_TRUE(manager.quickMatch(quick_game_q, quick_player_q, &player_id, SURVIVAL, DHARD));
+
+    EXPECT_EQ(quick_game_q, other_game_q);
+    EXPECT_EQ(player_id, 3);
+    std::shared_ptr<Information> feed = quick_player_q->pop();
+    ASSERT_EQ(feed->get_type(), FEEDBACK_JOIN_GAME);
+    EXPECT_EQ(static_cast<JoinGameFeedback&>(*feed).joined, JOINED);
+}
+
+TEST(gamemanager_test, QuickMatchTest01WaitingPlayersShareTheGameCreatedForThem) {
+    constexpr std::size_t GROUP = 3;
+    GameManager manager(10000, 500, 50, GROUP, 5000);
+    std::vector<Queue<std::shared_ptr<InGameCommand>>*> game_qs(GROUP, nullptr);
+    std::vector<std::shared_ptr<Queue<std::shared_ptr<Information>>>> player_qs;
+    std::vector<std::uint8_t> player_ids(GROUP, 0);
+    std::vector<std::thread> players;
+    for (std::size_t number = 0; number < GROUP; number++) {
+        player_qs.push_back(std::make_shared<Queue<std::shared_ptr<Information>>>(10000));
+    }
+    for (std::size_t number = 0; number < GROUP; number++) {
+        players.emplace_back([&, number]() {
+            manager.quickMatch(game_qs[number], player_qs[number], &player_ids[number],
+                               CLEAR_THE_ZONE, DNORMAL);
+        });
+    }
+    for (auto& player : players) player.join();
+
+    std::size_t created = 0;
+    for (std::size_t number = 0; number < GROUP; number++) {
+        EXPECT_EQ(game_qs[number], game_qs[0]);
+        if (player_qs[number]->pop()->get_type() == FEEDBACK_CREATE_GAME) created++;
+    }
+    EXPECT_NE(game_qs[0], nullptr);
+    EXPECT_EQ(created, 1u);
+    std::vector<GameSummaryDTO> open = manager.listGames(CLEAR_THE_ZONE, DNORMAL);
+    ASSERT_EQ(open.size(), 1u);
+    EXPECT_EQ(open.at(0).players, GROUP);
+}
+
+TEST(gamemanager_test, QuickMatchTest02ALonePlayerGetsAGameAfterTheMaxWait) {
+    std::uint8_t player_id = 0;
+    GameManager manager(10000, 500, 50, 4, 50);
+    Queue<std::shared_ptr<InGameCommand>>* game_q = nullptr;
+    std::shared_ptr<Queue<std::shared_ptr<Information>>> player_q =
+            std::make_shared<Queue<std::shared_ptr<Information>>>(10000);
+
+    ASSERT_TRUE(manager.quickMatch(game_q, player_q, &player_id, SURVIVAL, DINSANE));
+
+    EXPECT_NE(game_q, nullptr);
+    EXPECT_EQ(player_id, 1);
+    EXPECT_EQ(player_q->pop()->get_type(), FEEDBACK_CREATE_GAME);
+}
+
+TEST(gamemanager_test, QuickMatchTest03DisconnectedWaitersDoNotCompleteAGroup) {
+    std::uint8_t gone_id = 0;
+    std::uint8_t player_id = 0;
+    auto manager = std::make_unique<GameManager>(10000, 500, 50, 2, 60000);
+    Queue<std::shared_ptr<InGameCommand>>* gone_game_q = nullptr;
+    std::shared_ptr<Queue<std::shared_ptr<Information>>> gone_player_q =
+            std::make_shared<Queue<std::shared_ptr<Information>>>(10000);
+    bool gone_joined = true;
+    std::thread gone([&]() {
+        gone_joined = manager->quickMatch(gone_game_q, gone_player_q, &gone_id, SURVIVAL, DEASY);
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    gone_player_q->close();
+
+    // el que llega no completa el grupo con el que se fue: queda esperando
+    Queue<std::shared_ptr<InGameCommand>>* game_q = nullptr;
+    std::shared_ptr<Queue<std::shared_ptr<Information>>> player_q =
+            std::make_shared<Queue<std::shared_ptr<Information>>>(10000);
+    bool joined = true;
+    std::thread waiting([&]() {
+        joined = manager->quickMatch(game_q, player_q, &player_id, SURVIVAL, DEASY);
+    });
+    gone.join();
+    EXPECT_FALSE(gone_joined);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_TRUE(manager->listGames(LOBBY_ANY, LOBBY_ANY).empty());
+
+    // al frenar, el que esperaba se despierta sin partida
+    manager.reset();
+    waiting.join();
+    EXPECT_FALSE(joined);
+    EXPECT_EQ(game_q, nullptr);
+}
+
+TEST(gamemanager_test, AdmissionTest01ConnectionsOverTheCapAreRejectedUntilOneLeaves) {
+    Admission admission(2);
+
+    EXPECT_TRUE(admission.tryAdmit());
+    EXPECT_TRUE(admission.tryAdmit());
+    EXPECT_FALSE(admission.tryAdmit());
+    EXPECT_EQ(admission.active(), 2u);
+    EXPECT_EQ(admission.rejectedCount(), 1u);
+
+    admission.release();
+    EXPECT_TRUE(admission.tryAdmit());
+}
+
+TEST(gamemanager_test, RateTest00CongestionDoublesTheStrideAndACleanLinkRecoversIt) {
+    SnapshotRate rate(8, 1000, 100000, 10, 2);
+
+    rate.report(5000, 0);
+    EXPECT_EQ(rate.getStride(), 2u);
+    rate.report(0, 200000);
+    EXPECT_EQ(rate.getStride(), 4u);
+    rate.report(5000, 0);
+    rate.report(5000, 0);
+    EXPECT_EQ(rate.getStride(), 8u);
+
+    rate.report(0, 0);
+    EXPECT_EQ(rate.getStride(), 8u);
+    rate.report(0, 0);
+    EXPECT_EQ(rate.getStride(), 7u);
+    for (int i = 0; i < 20; ++i) rate.report(0, 0);
+    EXPECT_EQ(rate.getStride(), 1u);
+}
+
+TEST(gamemanager_test, RateTest01OnlyEveryStrideTicksAndBelowMaxPendingAreSent) {
+    SnapshotRate rate(4, 1000, 100000, 2, 1);
+    rate.report(5000, 0);
+
+    int sent = 0;
+    for (int tick = 0; tick < 8; ++tick) {
+        if (!rate.shouldSend()) continue;
+        ++sent;
+        rate.enqueued();
+        rate.dequeued();
+    }
+    EXPECT_EQ(sent, 4);
+
+    rate.enqueued();
+    rate.enqueued();
+    for (int tick = 0; tick < 8; ++tick) {
+        EXPECT_FALSE(rate.shouldSend());
+    }
+    rate.dequeued();
+    rate.shouldSend();
+    EXPECT_TRUE(rate.shouldSend());
+}
+
+TEST(gamemanager_test, RateTest02ASlowClientStaysInTheGameWithABoundedQueue) {
+    using std::chrono::milliseconds;
+
+    Queue<std::shared_ptr<InGameCommand>>* game_q = nullptr;
+    auto player_q = std::make_shared<Queue<std::shared_ptr<Information>>>(10000);
+    auto rate = std::make_shared<SnapshotRate>(1, 1000, 100000, 3, 1);
+    std::uint8_t player_id;
+    GameManager manager = GameManager();
+
+    manager.createGame(game_q, player_q, &player_id, SURVIVAL, DEASY, rate);
+    std::this_thread::sleep_for(milliseconds(200));
+    EXPECT_EQ(rate->getPending(), 3);
+
+    std::shared_ptr<Information> feed;
+    int states = 0;
+    while (player_q->try_pop(feed)) {
+        if (feed->get_type() != FEEDBACK_GAME_STATE) continue;
+        ++states;
+        rate->dequeued();
+    }
+    EXPECT_EQ(states, 3);
+
+    // se libero la cola: vuelve a recibir
+    std::this_thread::sleep_for(milliseconds(100));
+    ASSERT_TRUE(player_q->try_pop(feed));
+    EXPECT_EQ(feed->get_type(), FEEDBACK_GAME_STATE);
+}
+
 int main(int argc, char** argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
 }
+
+TEST(gamemanager_test, LobbyTest04FullestFollowsPlayerCountChanges) {
+    LobbyIndex lobby;
+    GameSummaryDTO game{};
+    EXPECT_FALSE(lobby.fullest(SURVIVAL, DNORMAL, &game));
+
+    lobby.update(GameSummaryDTO{1111111, SURVIVAL, DNORMAL, 3, 10});
+    lobby.update(GameSummaryDTO{2222222, SURVIVAL, DNORMAL, 5, 10});
+    lobby.update(GameSummaryDTO{3333333, SURVIVAL, DHARD, 9, 10});
+    ASSERT_TRUE(lobby.fullest(SURVIVAL, DNORMAL, &game));
+    EXPECT_EQ(game.game_code, 2222222u);
+
+    // se unio gente a la primera: pasa adelante
+    lobby.update(GameSummaryDTO{1111111, SURVIVAL, DNORMAL, 7, 10});
+    ASSERT_TRUE(lobby.fullest(SURVIVAL, DNORMAL, &game));
+    EXPECT_EQ(game.game_code, 1111111u);
+    EXPECT_EQ(game.players, 7);
+
+    // se lleno y despues se saca la otra: no queda ninguna
+    lobby.update(GameSummaryDTO{1111111, SURVIVAL, DNORMAL, 10, 10});
+    ASSERT_TRUE(lobby.fullest(SURVIVAL, DNORMAL, &game));
+    EXPECT_EQ(game.game_code, 2222222u);
+    lobby.remove(2222222, SURVIVAL, DNORMAL);
+    EXPECT_FALSE(lobby.fullest(SURVIVAL, DNORMAL, &game));
+}
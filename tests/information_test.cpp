@@ -4,8 +4,16 @@
 #include "Information/Actions/shoot_start.h"
 #include "Information/Actions/game_join.h"
 #include "Information/Actions/game_create.h"
+#include "Information/Actions/view_hint.h"
 #include "Information/state_dto_element.h"
 #include "Information/feedback_server_gamestate.h"
+#include "Information/feedback_server_datagramoffer.h"
+#include "Information/feedback_server_compression.h"
+#include "Information/Requests/compression.h"
+#include "Information/feedback_server_gamelist.h"
+#include "Information/Requests/list_games.h"
+#include "Information/Requests/quick_match.h"
+#include "Information/compact_encoding.h"
 
 enum JoinGameVector : std::uint8_t {
     JOIN_GAME_ID,
@@ -93,6 +101,23 @@ TEST(informatio_test,
     EXPECT_EQ(serialized_join[BYTE_4], 0x78);
 }
 
+TEST(information_test, ViewHintTest00WindowIsSerializedInBigEndian) {
+    using std::int8_t;
+    using std::vector;
+
+    auto hint = ViewHintAction(0x00012345, 0x0500);
+    vector<int8_t> serialized_hint = hint.serialize();
+
+    ASSERT_EQ(serialized_hint.size(), 7);
+    EXPECT_EQ(serialized_hint[0], InformationID::ACTION_VIEW_HINT);
+    EXPECT_EQ(serialized_hint[1], 0x00);
+    EXPECT_EQ(serialized_hint[2], 0x01);
+    EXPECT_EQ(serialized_hint[3], 0x23);
+    EXPECT_EQ(serialized_hint[4], 0x45);
+    EXPECT_EQ(serialized_hint[5], 0x05);
+    EXPECT_EQ(serialized_hint[6], 0x00);
+}
+
 TEST(information_test,
      GameStateSerialize00EachByteOfActorIDShouldBeSerializedProperly) {
     using std::uint8_t;
@@ -139,6 +164,204 @@ TEST(information_test,
     EXPECT_EQ(serialized_game_state.at(25), 0x01);
 }
 
+TEST(information_test,
+     GameStateSerialize01LeftElementsAreSerializedAfterTheElements) {
+    using std::uint16_t;
+    using std::vector;
+    using std::pair;
+
+    vector<pair<uint16_t, ElementStateDTO>> actors;
+    vector<uint16_t> left_actors {0x0102, 0x0304};
+    GameStateFeedback game_state = GameStateFeedback(std::move(actors), std::move(left_actors));
+
+    vector<int8_t> serialized_game_state = game_state.serialize();
+
+    ASSERT_EQ(serialized_game_state.size(), 9);
+    EXPECT_EQ(serialized_game_state.at(0), InformationID::FEEDBACK_GAME_STATE);
+    EXPECT_EQ(serialized_game_state.at(1), 0x00);
+    EXPECT_EQ(serialized_game_state.at(2), 0x00);
+    EXPECT_EQ(serialized_game_state.at(3), 0x00);
+    EXPECT_EQ(serialized_game_state.at(4), 0x02);
+    EXPECT_EQ(serialized_game_state.at(5), 0x01);
+    EXPECT_EQ(serialized_game_state.at(6), 0x02);
+    EXPECT_EQ(serialized_game_state.at(7), 0x03);
+    EXPECT_EQ(serialized_game_state.at(8), 0x04);
+}
+
+TEST(information_test, DatagramOfferTest00PortAndTokenAreSerializedInBigEndian) {
+    DatagramOfferFeedback offer(0x0102, 0x03040506);
+
+    std::vector<int8_t> serialized_offer = offer.serialize();
+
+    ASSERT_EQ(serialized_offer.size(), 7);
+    EXPECT_EQ(serialized_offer.at(0), InformationID::FEEDBACK_DATAGRAM_OFFER);
+    EXPECT_EQ(serialized_offer.at(1), 0x01);
+    EXPECT_EQ(serialized_offer.at(2), 0x02);
+    EXPECT_EQ(serialized_offer.at(3), 0x03);
+    EXPECT_EQ(serialized_offer.at(4), 0x04);
+    EXPECT_EQ(serialized_offer.at(5), 0x05);
+    EXPECT_EQ(serialized_offer.at(6), 0x06);
+}
+
+TEST(information_test, CompressionTest00AnswerCarriesTheCodec) {
+    CompressionFeedback answer(COMPRESSION_DEFLATE);
+
+    std::vector<int8_t> serialized_answer = answer.serialize();
+
+    ASSERT_EQ(serialized_answer.size(), 2);
+    EXPECT_EQ(serialized_answer.at(0), InformationID::FEEDBACK_COMPRESSION);
+    EXPECT_EQ(serialized_answer.at(1), COMPRESSION_DEFLATE);
+    EXPECT_EQ(CompressionRequest(COMPRESSION_DEFLATE).serialize(),
+              (std::vector<int8_t>{REQUEST_COMPRESSION, COMPRESSION_DEFLATE}));
+}
+
+TEST(information_test, GameListTest00EveryGameTakesEightBytesAfterTheCount) {
+    GameListFeedback list({GameSummaryDTO{0x01020304, SURVIVAL, DHARD, 3, 10}});
+
+    std::vector<int8_t> serialized_list = list.serialize();
+
+    EXPECT_EQ(serialized_list, (std::vector<int8_t>{FEEDBACK_GAME_LIST, 0x00, 0x01,
+                                                    0x01, 0x02, 0x03, 0x04,
+                                                    SURVIVAL, DHARD, 3, 10}));
+    EXPECT_EQ(ListGamesRequest(REQUEST_SURVIVAL, VOID).serialize(),
+              (std::vector<int8_t>{REQUEST_LIST_GAMES, REQUEST_SURVIVAL, static_cast<int8_t>(VOID)}));
+}
+
+TEST(information_test, QuickMatchTest00RequestCarriesModeAndDifficulty) {
+    EXPECT_EQ(QuickMatchRequest(REQUEST_CLEAR_THE_ZONE, REQUEST_HARD).serialize(),
+              (std::vector<int8_t>{REQUEST_QUICK_MATCH, REQUEST_CLEAR_THE_ZONE, REQUEST_HARD}));
+}
+
+TEST(information_test, CompactTest00VarintAndZigZagRoundTrip) {
+    std::vector<int8_t> buffer;
+    CompactWriter writer(buffer);
+    writer.putVarint(0);
+    writer.putVarint(127);
+    writer.putVarint(128);
+    writer.putVarint(0xFFFFFFFF);
+    writer.putZigZag(-1);
+    writer.putZigZag(50000);
+    writer.putZigZag(-2147483647 - 1);
+
+    ASSERT_EQ(buffer.size(), 1u + 1 + 2 + 5 + 1 + 3 + 5);
+    EXPECT_EQ(static_cast<uint8_t>(buffer.at(2)), 0x80);
+    EXPECT_EQ(buffer.at(3), 0x01);
+
+    CompactReader reader(buffer);
+    EXPECT_EQ(reader.getVarint(), 0u);
+    EXPECT_EQ(reader.getVarint(), 127u);
+    EXPECT_EQ(reader.getVarint(), 128u);
+    EXPECT_EQ(reader.getVarint(), 0xFFFFFFFFu);
+    EXPECT_EQ(reader.getZigZag(), -1);
+    EXPECT_EQ(reader.getZigZag(), 50000);
+    EXPECT_EQ(reader.getZigZag(), -2147483647 - 1);
+    EXPECT_EQ(reader.remaining(), 0u);
+    EXPECT_THROW(reader.getByte(), std::runtime_error);
+}
+
+static std::vector<std::pair<uint16_t, ElementStateDTO>> typicalSnapshot() {
+    std::vector<std::pair<uint16_t, ElementStateDTO>> actors;
+    actors.emplace_back(1, ElementStateDTO{GRENADE, SOLDIER_1_EXPLOSION, 1, 1210, 40, 0, 0, 0, 0, 0, 0});
+    actors.emplace_back(2, ElementStateDTO{SOLDIER_IDF, SOLDIER_1_SHOOT_1, -1, 1200, 150, 100, 80, 50, 12, 3, 0});
+    actors.emplace_back(3, ElementStateDTO{SOLDIER_P90, SOLDIER_2_WALK, 1, 1320, 20, 100, 100, 30, 30, 0, 0});
+    for (uint16_t id = 10; id < 40; ++id) {
+        actors.emplace_back(id, ElementStateDTO{ZOMBIE, ZOMBIE_WALK, static_cast<int8_t>(id % 2 ? 1 : -1),
+                                                1000 + id * 37, id * 5, 100,
+                                                static_cast<uint16_t>(id % 3 ? 100 : 35), 0, 0, 0, 0});
+    }
+    return actors;
+}
+
+TEST(information_test, GameStateCompact00HeaderHasIdVersionAndPayloadSize) {
+    std::vector<std::pair<uint16_t, ElementStateDTO>> actors;
+    actors.emplace_back(0x0102, ElementStateDTO{ZOMBIE, ZOMBIE_RUN, -1, 300, 100, 0, 0, 0, 0, 0, 1});
+    GameStateFeedback game_state(std::move(actors), std::vector<uint16_t>{7});
+
+    std::vector<int8_t> compact = game_state.serializeCompact();
+
+    // varint(1) + x base(2) + id(2) + tag + flags + x(1) + y(2) + varint(1) + left id(1)
+    ASSERT_EQ(compact.size(), 3u + 12);
+    EXPECT_EQ(compact.at(0), InformationID::FEEDBACK_GAME_STATE_COMPACT);
+    EXPECT_EQ(compact.at(1), GAME_STATE_COMPACT_VERSION);
+    EXPECT_EQ(compact.at(2), 12);
+    EXPECT_EQ(compact.at(8), ZOMBIE | (SCHEMA_PLAIN << 4));
+    EXPECT_EQ(static_cast<uint8_t>(compact.at(9)), ZOMBIE_RUN | (0 << 5) | 0x80);
+}
+
+TEST(information_test, GameStateCompact01RoundTripKeepsEveryField) {
+    GameStateFeedback game_state(typicalSnapshot(), std::vector<uint16_t>{500, 501});
+    std::vector<int8_t> compact = game_state.serializeCompact();
+    std::vector<int8_t> payload(compact.begin() + 3, compact.end());
+    ASSERT_EQ(static_cast<uint8_t>(compact.at(2)) & 0x80, 0x80);
+    payload.erase(payload.begin());  // el largo ocupa 2 bytes
+
+    std::shared_ptr<GameStateFeedback> decoded = GameStateFeedback::fromCompact(compact.at(1), payload);
+
+    ASSERT_EQ(decoded->elements.size(), game_state.elements.size());
+    for (std::size_t i = 0; i < game_state.elements.size(); ++i) {
+        const auto& expected = game_state.elements[i];
+        const auto& actual = decoded->elements[i];
+        EXPECT_EQ(actual.first, expected.first);
+        EXPECT_EQ(actual.second.type, expected.second.type);
+        EXPECT_EQ(actual.second.action, expected.second.action);
+        EXPECT_EQ(actual.second.direction, expected.second.direction);
+        EXPECT_EQ(actual.second.position_x, expected.second.position_x);
+        EXPECT_EQ(actual.second.position_y, expected.second.position_y);
+        EXPECT_EQ(actual.second.health, expected.second.health);
+        EXPECT_EQ(actual.second.actual_health, expected.second.actual_health);
+        EXPECT_EQ(actual.second.ammo, expected.second.ammo);
+        EXPECT_EQ(actual.second.actual_ammo, expected.second.actual_ammo);
+        EXPECT_EQ(actual.second.time_left, expected.second.time_left);
+        EXPECT_EQ(actual.second.is_dead, expected.second.is_dead);
+    }
+    EXPECT_EQ(decoded->left_elements, game_state.left_elements);
+    EXPECT_EQ(decoded->serialize(), game_state.serialize());
+}
+
+TEST(information_test, GameStateCompact02IsAtLeastTwoAndAHalfTimesSmaller) {
+    GameStateFeedback game_state(typicalSnapshot());
+
+    std::size_t legacy_size = game_state.serialize().size();
+    std::size_t compact_size = game_state.serializeCompact().size();
+
+    EXPECT_GE(legacy_size * 10, compact_size * 25);
+}
+
+TEST(information_test, GameStateCompact03UnknownVersionOrTruncatedPayloadThrows) {
+    GameStateFeedback game_state(typicalSnapshot());
+    std::vector<int8_t> compact = game_state.serializeCompact();
+    std::vector<int8_t> payload(compact.begin() + 4, compact.end());
+
+    EXPECT_THROW(GameStateFeedback::fromCompact(GAME_STATE_COMPACT_VERSION + 1, payload),
+                 std::runtime_error);
+    payload.resize(payload.size() / 2);
+    EXPECT_THROW(GameStateFeedback::fromCompact(GAME_STATE_COMPACT_VERSION, payload),
+                 std::runtime_error);
+}
+
+TEST(information_test, GameStateCompact04ValuesOutOfTheSchemaAreRejected) {
+    std::vector<std::pair<uint16_t, ElementStateDTO>> actors;
+    actors.emplace_back(1, ElementStateDTO{ZOMBIE, 40, 1, 0, 0, 0, 0, 0, 0, 0, 0});
+    GameStateFeedback game_state(std::move(actors));
+
+    EXPECT_THROW(game_state.serializeCompact(), std::runtime_error);
+}
+
+TEST(information_test, GameStateSerialize02SerializeIntoAppendsTheSameBytes) {
+    GameStateFeedback game_state(typicalSnapshot(), std::vector<uint16_t>{9});
+    std::vector<int8_t> buffer {42};
+
+    game_state.serializeInto(buffer);
+    game_state.serializeCompactInto(buffer);
+
+    std::vector<int8_t> expected {42};
+    std::vector<int8_t> legacy = game_state.serialize();
+    std::vector<int8_t> compact = game_state.serializeCompact();
+    expected.insert(expected.end(), legacy.begin(), legacy.end());
+    expected.insert(expected.end(), compact.begin(), compact.end());
+    EXPECT_EQ(buffer, expected);
+}
+
 int main(int argc, char** argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
@@ -1,6 +1,8 @@
 #include <gtest/gtest.h>
 #include "GameLogic/match.h"
 #include "GameLogic/clearthezone.h"
+#include "GameLogic/survival.h"
+#include "GameLogic/vec2.h"
 #include "GameLogic/Soldiers/soldierfactory.h"
 #include "GameLogic/Soldiers/soldier.h"
 #include "../Common/include/Information/state_dto_element.h"
@@ -156,6 +158,351 @@ TEST(match_test, Test08Shoot) {
 
 }
 
+TEST(match_test, Test09ViewHintKeepsSoldiersAndDropsFarZombies) {
+
+    ClearTheZone match(50000, 200, DEASY, 1);
+    ASSERT_NO_FATAL_FAILURE(match.join(1, SOLDIER_IDF));
+    match.setZombie(100, ZOMBIE);
+
+    match.setViewHint(1, -100000, 1280);
+    std::vector<std::pair<uint16_t, ElementStateDTO>> dtos = match
+            .getElementStates(1);
+    ASSERT_EQ(dtos.size(), 1);
+    ASSERT_EQ(dtos.at(0).first, 1);
+}
+
+TEST(match_test, Test10ZombieLeavingInterestAreaIsReported) {
+
+    ClearTheZone match(50000, 200, DEASY, 1);
+    ASSERT_NO_FATAL_FAILURE(match.join(1, SOLDIER_IDF));
+    match.setZombie(999, ZOMBIE);
+    double soldier_x = match.getSoldiers().at(1)->getPosition().getXPos();
+    auto has_zombie = [](const std::vector<std::pair<uint16_t, ElementStateDTO>>& dtos) {
+        return std::any_of(dtos.begin(), dtos.end(),
+                           [](const auto& dto) { return dto.first == 999; });
+    };
+
+    match.zombies.at(999)->position.setXPos(soldier_x + 100);
+    std::vector<std::pair<uint16_t, ElementStateDTO>> dtos = match
+            .getElementStates(1);
+    ASSERT_TRUE(has_zombie(dtos));
+    match.updateInterest(1, dtos);
+
+    match.zombies.at(999)->position.setXPos(soldier_x + 10000);
+    dtos = match.getElementStates(1);
+    ASSERT_FALSE(has_zombie(dtos));
+    std::vector<uint16_t> left = match.updateInterest(1, dtos);
+    ASSERT_NE(std::find(left.begin(), left.end(), 999), left.end());
+}
+
+TEST(match_test, Test11PerceptionPicksNearestLiveSoldier) {
+
+    ClearTheZone match(50000, 200, DEASY, 1);
+    ASSERT_NO_FATAL_FAILURE(match.join(1, SOLDIER_IDF));
+    ASSERT_NO_FATAL_FAILURE(match.join(2, SOLDIER_IDF));
+    match.setZombie(999, ZOMBIE);
+    std::shared_ptr<Zombie> &zombie = match.zombies.at(999);
+    zombie->position.setXPos(20000);
+    zombie->position.setYPos(100);
+    match.getSoldiers().at(1)->getPosition().setXPos(20080);
+    match.getSoldiers().at(1)->getPosition().setYPos(100);
+    match.getSoldiers().at(2)->getPosition().setXPos(19970);
+    match.getSoldiers().at(2)->getPosition().setYPos(100);
+
+    match.perception.update(match.soldiers, match.zombies);
+    ASSERT_TRUE(zombie->sees_victim);
+    ASSERT_EQ(zombie->seen_victim_id, 2);
+
+    match.getSoldiers().at(2)->getPosition().setXPos(40000);
+    match.perception.update(match.soldiers, match.zombies);
+    ASSERT_TRUE(zombie->sees_victim);
+    ASSERT_EQ(zombie->seen_victim_id, 1);
+
+    match.getSoldiers().at(1)->getPosition().setXPos(30000);
+    match.perception.update(match.soldiers, match.zombies);
+    ASSERT_FALSE(zombie->sees_victim);
+}
+
+TEST(match_test, Test12FarZombiesAreSimulatedInSlices) {
+
+    ClearTheZone match(50000, 200, DEASY, 1);
+    ASSERT_NO_FATAL_FAILURE(match.join(1, SOLDIER_IDF));
+    match.setZombie(998, ZOMBIE);
+    match.setZombie(999, ZOMBIE);
+    match.getSoldiers().at(1)->getPosition().setXPos(1000);
+    match.zombies.at(998)->position.setXPos(1100);
+    match.zombies.at(999)->position.setXPos(40000);
+    match.perception.setLevelOfDetail(2000, 4);
+
+    int near_updates = 0;
+    int far_updates = 0;
+    for (int i = 0; i < 8; i++) {
+        match.perception.update(match.soldiers, match.zombies);
+        if (match.perception.shouldSimulate(*match.zombies.at(998))) near_updates++;
+        if (match.perception.shouldSimulate(*match.zombies.at(999))) far_updates++;
+    }
+    ASSERT_EQ(near_updates, 8);
+    ASSERT_EQ(far_updates, 2);
+}
+
+TEST(match_test, Test13FlowFieldLeadsToSoldierAndSeparatesZombies) {
+
+    ClearTheZone match(50000, 200, DEASY, 1);
+    ASSERT_NO_FATAL_FAILURE(match.join(1, SOLDIER_IDF));
+    match.setZombie(998, ZOMBIE);
+    match.setZombie(999, ZOMBIE);
+    match.getSoldiers().at(1)->getPosition().setXPos(20100);
+    match.getSoldiers().at(1)->getPosition().setYPos(100);
+    for (uint32_t id : {998, 999}) {
+        match.zombies.at(id)->position.setXPos(20000);
+        match.zombies.at(id)->position.setYPos(100);
+    }
+
+    match.perception.update(match.soldiers, match.zombies);
+    std::shared_ptr<Zombie> &first = match.zombies.at(998);
+    std::shared_ptr<Zombie> &second = match.zombies.at(999);
+    ASSERT_TRUE(first->flow_valid);
+    ASSERT_GT(first->flow_x, 0);
+    ASSERT_LT(first->separation_x, 0);
+    ASSERT_GT(second->separation_x, 0);
+}
+
+TEST(match_test, Test14DamageOfATickIsAccumulatedAndKillGoesToTopDamager) {
+
+    ClearTheZone match(50000, 200, DEASY, 1);
+    ASSERT_NO_FATAL_FAILURE(match.join(1, SOLDIER_IDF));
+    ASSERT_NO_FATAL_FAILURE(match.join(2, SOLDIER_IDF));
+    match.setZombie(998, ZOMBIE);
+    match.setZombie(999, ZOMBIE);
+    std::shared_ptr<Zombie> &hurt = match.zombies.at(998);
+    std::shared_ptr<Zombie> &killed = match.zombies.at(999);
+    double health = hurt->getActualHealth();
+
+    hurt->recvDamage(ON, 10, 1);
+    hurt->recvDamage(ON, 20, 2);
+    killed->recvDamage(ON, health * 0.3, 1);
+    killed->recvDamage(ON, health * 0.4, 2);
+    killed->recvDamage(ON, health * 0.4, 2);
+    ASSERT_DOUBLE_EQ(hurt->getActualHealth(), health);
+
+    match.damage_buffer.resolve(std::chrono::system_clock::now(), match.soldiers, match.zombies);
+    ASSERT_TRUE(match.damage_buffer.empty());
+    ASSERT_DOUBLE_EQ(hurt->getActualHealth(), health - 30);
+    ASSERT_FALSE(hurt->isDying());
+    ASSERT_TRUE(killed->isDying());
+    ASSERT_EQ(match.getSoldiers().at(1)->kill_counter, 0);
+    ASSERT_EQ(match.getSoldiers().at(2)->kill_counter, 1);
+}
+
+TEST(match_test, Test15ParallelZombiePhaseMergesDamageFromAllLanes) {
+
+    ClearTheZone match(50000, 200, DEASY, 1);
+    ASSERT_NO_FATAL_FAILURE(match.join(1, SOLDIER_IDF));
+    std::shared_ptr<Soldier> &soldier = match.getSoldiers().at(1);
+    soldier->getPosition().setXPos(20000);
+    soldier->getPosition().setYPos(100);
+    for (uint32_t id = 1000; id < 1040; id++) {
+        match.setZombie(id, ZOMBIE);
+        match.zombies.at(id)->position.setXPos(20002);
+        match.zombies.at(id)->position.setYPos(100);
+    }
+    match.setParallelism(3, 1, 4);
+    double health = soldier->getActualHealth();
+
+    // primer tick: detectan y empiezan a atacar, segundo: pegan
+    ASSERT_NO_THROW(match.simulateStep(std::chrono::system_clock::now()));
+    ASSERT_NO_THROW(match.simulateStep(std::chrono::system_clock::now()));
+    ASSERT_TRUE(match.damage_buffer.empty());
+    ASSERT_LT(soldier->getActualHealth(), health);
+}
+
+TEST(match_test, Test16SpawnPlacerAvoidsSoldiersAndIsReproducible) {
+
+    ClearTheZone match(50000, 200, DEASY, 1);
+    ASSERT_NO_FATAL_FAILURE(match.join(1, SOLDIER_IDF));
+    ASSERT_NO_FATAL_FAILURE(match.join(2, SOLDIER_IDF));
+    ASSERT_NO_FATAL_FAILURE(match.join(3, SOLDIER_IDF));
+    // los que entran no se pisan entre ellos
+    ASSERT_FALSE(match.soldiers.at(1)->seePosition().collides(match.soldiers.at(2)->seePosition()));
+    ASSERT_FALSE(match.soldiers.at(2)->seePosition().collides(match.soldiers.at(3)->seePosition()));
+    match.soldiers.at(3)->getPosition().setXPos(49990); // del otro lado del borde del mapa
+
+    SpawnPlacer placer(7);
+    SpawnPlacer same_seed(7);
+    for (int i = 0; i < 3000; i++) {
+        Position pos = placer.place(match.soldiers, 0, 2000, 20, 40, 50000, 200);
+        Position again = same_seed.place(match.soldiers, 0, 2000, 20, 40, 50000, 200);
+        ASSERT_TRUE(pos == again);
+        for (auto & soldier : match.soldiers) {
+            ASSERT_FALSE(pos.collides(soldier.second->seePosition()));
+        }
+    }
+
+    // si no queda lugar libre igual devuelve una posicion
+    match.soldiers.at(1)->getPosition().setXPos(25000);
+    ASSERT_NO_THROW(placer.place(match.soldiers, 25000, 5, 20, 40, 50000, 40));
+    ASSERT_EQ(placer.freeSlots(), 0);
+}
+
+TEST(match_test, Test17WaveIsSpreadAcrossTicksAndUsesPrewarmedZombies) {
+
+    Survival match(50000, 200, DINSANE, 1);
+    ASSERT_NO_FATAL_FAILURE(match.join(1, SOLDIER_IDF));
+    size_t initial = match.zombies.size();
+    // oleada de 23 zombies, 4 por tick y 2 precreados de cada tipo
+    match.director.configure(30, 0.25, 4, 1000, 2);
+    match.director.start(std::chrono::system_clock::now());
+    match.director.launchWave();
+    ASSERT_EQ(match.director.pending(), 23);
+
+    size_t ticks = 0;
+    while (match.director.pending() > 0) {
+        size_t before = match.zombies.size();
+        match.director.step(std::chrono::system_clock::now(), match);
+        ASSERT_LE(match.zombies.size() - before, 4);
+        ticks++;
+    }
+    ASSERT_EQ(ticks, 6);
+    ASSERT_EQ(match.zombies.size(), initial + 23);
+
+    // sin oleada pendiente llena el pool de a tandas
+    for (int i = 0; i < 5; i++) match.director.step(std::chrono::system_clock::now(), match);
+    ASSERT_EQ(match.director.pooled(), 10);
+
+    // la segunda oleada crece y sale primero del pool
+    match.director.launchWave();
+    ASSERT_EQ(match.director.pending(), 31);
+    match.director.step(std::chrono::system_clock::now(), match);
+    ASSERT_EQ(match.director.pooled(), 6);
+    ASSERT_EQ(match.zombies.size(), initial + 27);
+    for (auto & zombie : match.zombies) ASSERT_EQ(zombie.first, zombie.second->getId());
+}
+
+TEST(match_test, Test18DistancesWrapAroundTheMapEdge) {
+
+    Vec2 v{3, 4};
+    ASSERT_DOUBLE_EQ(v.lengthSq(), 25);
+    ASSERT_DOUBLE_EQ(v.dot(Vec2{1, 1}), 7);
+    ASSERT_DOUBLE_EQ(v.normalized().length(), 1);
+    Vec2 zero{0, 0};
+    ASSERT_DOUBLE_EQ(zero.normalized().lengthSq(), 0);
+    ASSERT_DOUBLE_EQ(v.clamped(1).length(), 1);
+    Vec2 short_one{0.3, 0.4};
+    ASSERT_DOUBLE_EQ(short_one.clamped(1).x, 0.3);
+
+    // mapa de 1000: de 995 a 5 hay 11 pasando por el borde
+    Position near_edge(995, 100, 10, 10, 1000, 200);
+    Position other_side(5, 100, 10, 10, 1000, 200);
+    ASSERT_DOUBLE_EQ(delta(near_edge, other_side).x, 11);
+    ASSERT_DOUBLE_EQ(delta(other_side, near_edge).x, -11);
+    ASSERT_DOUBLE_EQ(distanceSq(near_edge, other_side), 121);
+    RadialHitbox blast(995, 100, 20);
+    ASSERT_TRUE(blast.hits(other_side));
+
+    std::vector<Perception::Target> targets = {{5, 100, 1}, {500, 100, 2}};
+    Perception::Target found{0, 0, 0};
+    ASSERT_FALSE(Perception::nearest(targets, 995, 100, 50, 0, &found));
+    ASSERT_TRUE(Perception::nearest(targets, 995, 100, 50, 0, &found, 1001));
+    ASSERT_EQ(found.id, 1);
+}
+
+TEST(match_test, Test19LeavingPlayerForgetsItsWindowAndInterest) {
+
+    ClearTheZone match(50000, 200, DEASY, 1);
+    ASSERT_NO_FATAL_FAILURE(match.join(1, SOLDIER_IDF));
+    match.setViewHint(1, 0, 1280);
+    match.updateInterest(1, match.getElementStates(1));
+    ASSERT_EQ(match.view_hints.size(), 1);
+    ASSERT_EQ(match.interest_sets.size(), 1);
+
+    match.delete_soldier(1);
+    ASSERT_TRUE(match.view_hints.empty());
+    ASSERT_TRUE(match.interest_sets.empty());
+}
+
+TEST(match_test, Test20DeferredZombiesStillSeeTheirCurrentTarget) {
+
+    ClearTheZone match(50000, 200, DEASY, 1);
+    ASSERT_NO_FATAL_FAILURE(match.join(1, SOLDIER_IDF));
+    match.setZombie(999, ZOMBIE);
+    std::shared_ptr<Zombie> &zombie = match.zombies.at(999);
+    zombie->position.setXPos(20000);
+    zombie->position.setYPos(100);
+    match.getSoldiers().at(1)->getPosition().setXPos(20080);
+    match.getSoldiers().at(1)->getPosition().setYPos(100);
+    // a 80 lo ve, pero para el nivel de detalle ya es lejano
+    match.perception.setLevelOfDetail(50, 4);
+
+    int deferred = 0;
+    for (int i = 0; i < 4; i++) {
+        match.perception.update(match.soldiers, match.zombies);
+        if (!match.perception.shouldSimulate(*zombie)) deferred++;
+        ASSERT_TRUE(zombie->sees_victim);
+        ASSERT_EQ(zombie->seen_victim_id, 1);
+    }
+    ASSERT_EQ(deferred, 3);
+
+    match.getSoldiers().at(1)->getPosition().setXPos(30000);
+    for (int i = 0; i < 4; i++) {
+        match.perception.update(match.soldiers, match.zombies);
+        ASSERT_FALSE(zombie->sees_victim);
+    }
+}
+
+TEST(match_test, Test21ZombiesDoNotWalkIntoEachOther) {
+
+    ClearTheZone match(50000, 200, DEASY, 1);
+    match.setZombie(998, ZOMBIE);
+    match.setZombie(999, ZOMBIE);
+    std::shared_ptr<Zombie> &walker = match.zombies.at(998);
+    std::shared_ptr<Zombie> &blocker = match.zombies.at(999);
+    walker->position.setXPos(20000);
+    walker->position.setYPos(100);
+    blocker->position.setXPos(20000 + walker->position.width + 1);
+    blocker->position.setYPos(100);
+    match.perception.update(match.soldiers, match.zombies);
+
+    Position step = walker->position;
+    step.setXPos(20002);
+    ASSERT_TRUE(match.perception.blocked(998, step, false));
+    ASSERT_FALSE(match.perception.blocked(999, blocker->position, false));
+    step.setXPos(19990);
+    ASSERT_FALSE(match.perception.blocked(998, step, false));
+
+    // del otro lado del borde del mapa tambien choca
+    blocker->position.setXPos(1);
+    match.perception.update(match.soldiers, match.zombies);
+    step.setXPos(50000.5);
+    ASSERT_TRUE(match.perception.blocked(998, step, false));
+}
+
+TEST(match_test, Test22InterestAreaWrapsAroundTheMapEdge) {
+
+    ClearTheZone match(50000, 200, DEASY, 1);
+    ASSERT_NO_FATAL_FAILURE(match.join(1, SOLDIER_IDF));
+    match.setZombie(999, ZOMBIE);
+    match.getSoldiers().at(1)->getPosition().setXPos(5);
+    match.zombies.at(999)->position.setXPos(49990);
+    auto has_zombie = [](const std::vector<std::pair<uint16_t, ElementStateDTO>>& dtos) {
+        return std::any_of(dtos.begin(), dtos.end(),
+                           [](const auto& dto) { return dto.first == 999; });
+    };
+
+    // sin ventana: centro de masa en 5, el zombie esta a 16 del otro lado del borde
+    std::vector<std::pair<uint16_t, ElementStateDTO>> dtos = match.getElementStates(1);
+    ASSERT_TRUE(has_zombie(dtos));
+    match.updateInterest(1, dtos);
+
+    // con la ventana centrada en 0 tampoco sale del area al cruzar el borde
+    match.setViewHint(1, -640, 1280);
+    dtos = match.getElementStates(1);
+    ASSERT_TRUE(has_zombie(dtos));
+    ASSERT_TRUE(match.updateInterest(1, dtos).empty());
+
+    match.zombies.at(999)->position.setXPos(25000);
+    dtos = match.getElementStates(1);
+    ASSERT_FALSE(has_zombie(dtos));
+}
 
 int main(int argc, char** argv) {
     ::testing::InitGoogleTest(&argc, argv);
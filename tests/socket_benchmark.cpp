@@ -0,0 +1,70 @@
+#include <benchmark/benchmark.h>
+#include "Socket/socket_game.h"
+#include "Socket/socket_options.h"
+
+#include <sys/socket.h>
+#include <string>
+#include <thread>
+
+// Ida y vuelta por loopback de un comando partido en dos send (id + datos),
+// como pasa cuando nadie junta los bytes antes de mandar.
+// Con Nagle el segundo send espera el ACK demorado del primero (~40ms).
+#define COMMAND_HEADER 1
+#define COMMAND_BODY 8
+
+static SocketOptions optionsFor(const benchmark::State& state) {
+    SocketOptions options;
+    options.no_delay = state.range(0);
+    options.quick_ack = state.range(1);
+    options.cork = state.range(2);
+    return options;
+}
+
+static void echo(GameSocket& peer) {
+    std::int8_t command[COMMAND_HEADER + COMMAND_BODY];
+    try {
+        while (true) {
+            peer.recvData(command, sizeof(command));
+            peer.rearmQuickAck();
+            peer.beginFlush();
+            peer.sendData(command, COMMAND_HEADER);
+            peer.sendData(command + COMMAND_HEADER, COMMAND_BODY);
+            peer.endFlush();
+        }
+    } catch (const std::exception& e) {
+        // el cliente cerro
+    }
+}
+
+static void BM_CommandRoundTrip(benchmark::State& state) {
+    static int port = 47100;
+    std::string servname = std::to_string(port++);
+    SocketOptions options = optionsFor(state);
+
+    GameSocket listener(servname.c_str());
+    GameSocket client("localhost", servname.c_str());
+    GameSocket peer = listener.acceptClient();
+    client.applyOptions(options);
+    peer.applyOptions(options);
+    client.setInGame(true);
+    peer.setInGame(true);
+    std::thread server(echo, std::ref(peer));
+
+    std::int8_t command[COMMAND_HEADER + COMMAND_BODY] = {};
+    for (auto _ : state) {
+        client.beginFlush();
+        client.sendData(command, COMMAND_HEADER);
+        client.sendData(command + COMMAND_HEADER, COMMAND_BODY);
+        client.endFlush();
+        client.recvData(command, sizeof(command));
+        client.rearmQuickAck();
+    }
+    client._shutdown(SHUT_RDWR);
+    server.join();
+}
+// nodelay, quickack, cork
+BENCHMARK(BM_CommandRoundTrip)->ArgNames({"nodelay", "quickack", "cork"})
+    ->Args({0, 0, 0})->Args({1, 0, 0})->Args({1, 1, 0})->Args({0, 0, 1})->Args({1, 1, 1})
+    ->Iterations(50)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
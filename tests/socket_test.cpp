@@ -0,0 +1,277 @@
+#include <gtest/gtest.h>
+#include <netinet/in.h>
+#include <sys/resource.h>
+#include <unistd.h>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <chrono>
+#include <vector>
+#include "Socket/socket_datagram.h"
+#include "Socket/socket_buffer.h"
+#include "Socket/socket_game.h"
+#include "Socket/buffer_pool.h"
+#include "Socket/frame_compression.h"
+#include "Information/information_code.h"
+#include "Information/feedback_server_datagramoffer.h"
+#include "Information/feedback_server_gamestate.h"
+
+constexpr int WAIT_MS = 1000;
+
+TEST(socket_test, DatagramTest00HelloLetsTheServerAnswerToTheClient) {
+    DatagramSocket server("0");
+    std::string port = std::to_string(server.localPort());
+    DatagramSocket client("localhost", port.c_str());
+
+    std::uint32_t hello = htonl(0xCAFE);
+    client.sendDatagram(&hello, sizeof(hello));
+
+    std::uint32_t received_hello = 0;
+    ASSERT_EQ(server.recvDatagram(&received_hello, sizeof(received_hello), WAIT_MS), sizeof(hello));
+    EXPECT_EQ(ntohl(received_hello), 0xCAFEu);
+    server.connectToLastPeer();
+
+    const char snapshot[] = "snapshot";
+    server.sendDatagram(snapshot, sizeof(snapshot));
+    char received[32] = {};
+    ASSERT_EQ(client.recvDatagram(received, sizeof(received), WAIT_MS), sizeof(snapshot));
+    EXPECT_STREQ(received, snapshot);
+}
+
+TEST(socket_test, DatagramTest01NothingArrivedReturnsZeroAfterTimeout) {
+    DatagramSocket server("0");
+    char received[8];
+    EXPECT_EQ(server.recvDatagram(received, sizeof(received), 10), 0u);
+}
+
+TEST(socket_test, DatagramTest02FullSimulatedLossDropsEveryDatagram) {
+    DatagramSocket server("0");
+    std::string port = std::to_string(server.localPort());
+    DatagramSocket client("localhost", port.c_str());
+    client.setLoss(1.0);
+
+    char data = 1;
+    for (int i = 0; i < 10; ++i) client.sendDatagram(&data, sizeof(data));
+    EXPECT_EQ(server.recvDatagram(&data, sizeof(data), 50), 0u);
+}
+
+TEST(socket_test, DatagramTest03SequenceComparisonSupportsWrapAround) {
+    EXPECT_TRUE(DatagramSocket::isNewer(2, 1));
+    EXPECT_FALSE(DatagramSocket::isNewer(1, 2));
+    EXPECT_FALSE(DatagramSocket::isNewer(7, 7));
+    EXPECT_TRUE(DatagramSocket::isNewer(0, 0xFFFFFFFF));
+    EXPECT_FALSE(DatagramSocket::isNewer(0xFFFFFFFF, 0));
+}
+
+TEST(socket_test, BufferTest00ReadsBackWhatWasWrittenAndThrowsOnUnderrun) {
+    DatagramOfferFeedback offer(0x1234, 0xA1B2C3D4);
+    std::vector<std::int8_t> serialized = offer.serialize();
+    BufferSocket buffer(serialized.data(), serialized.size());
+
+    std::uint8_t type;
+    std::uint16_t port;
+    std::uint32_t token;
+    buffer.recvData(&type, sizeof(type));
+    buffer.recvData(&port, sizeof(port));
+    buffer.recvData(&token, sizeof(token));
+
+    EXPECT_EQ(type, InformationID::FEEDBACK_DATAGRAM_OFFER);
+    EXPECT_EQ(ntohs(port), 0x1234);
+    EXPECT_EQ(ntohl(token), 0xA1B2C3D4u);
+    EXPECT_EQ(buffer.remaining(), 0u);
+    EXPECT_THROW(buffer.recvData(&type, sizeof(type)), ClosedSocket);
+}
+
+TEST(socket_test, GameSocketTest00SeveralBuffersArriveInOrderWithOneCall) {
+    GameSocket listener("47011");
+    GameSocket client("localhost", "47011");
+    GameSocket peer = listener.acceptClient();
+
+    std::vector<std::int8_t> first {1, 2, 3};
+    std::vector<std::int8_t> second {4};
+    std::vector<std::int8_t> third {5, 6};
+    struct iovec buffers[] = {{first.data(), first.size()},
+                              {second.data(), second.size()},
+                              {third.data(), third.size()}};
+    EXPECT_FALSE(peer.sendBuffers(buffers, 3));
+
+    std::int8_t received[6];
+    client.recvData(received, sizeof(received));
+    for (std::int8_t i = 0; i < 6; ++i) {
+        EXPECT_EQ(received[i], i + 1);
+    }
+}
+
+TEST(socket_test, GameSocketTest01ZeroCopySendsAreEventuallyReleased) {
+    GameSocket listener("47012");
+    GameSocket client("localhost", "47012");
+    GameSocket peer = listener.acceptClient();
+    if (!peer.enableZeroCopy()) {
+        GTEST_SKIP() << "SO_ZEROCOPY no disponible";
+    }
+
+    std::vector<std::int8_t> data(32 * 1024, 7);
+    struct iovec buffer {data.data(), data.size()};
+    bool zerocopy = peer.sendBuffers(&buffer, 1, true);
+    std::vector<std::int8_t> received(data.size());
+    client.recvData(received.data(), received.size());
+    EXPECT_EQ(received, data);
+    if (!zerocopy) return;
+
+    EXPECT_EQ(peer.zeroCopySent(), 1u);
+    for (int tries = 0; tries < 100 && peer.reapZeroCopy() != peer.zeroCopySent(); ++tries) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    EXPECT_EQ(peer.reapZeroCopy(), peer.zeroCopySent());
+}
+
+TEST(socket_test, GameSocketTest02CorkedFlushArrivesWhenItEnds) {
+    GameSocket listener("47013");
+    GameSocket client("localhost", "47013");
+    GameSocket peer = listener.acceptClient();
+    SocketOptions options;
+    options.no_delay = true;
+    options.quick_ack = true;
+    options.cork = true;
+    options.keepalive = true;
+    options.keepalive_idle = 10;
+    options.send_buffer = 64 * 1024;
+    ASSERT_NO_THROW(peer.applyOptions(options));
+    ASSERT_NO_THROW(peer.setInGame(true));
+
+    std::int8_t header = 1;
+    std::int32_t body = 2;
+    peer.beginFlush();
+    peer.sendData(&header, sizeof(header));
+    peer.sendData(&body, sizeof(body));
+    peer.endFlush();
+
+    std::int8_t received[5];
+    client.recvData(received, sizeof(received));
+    EXPECT_EQ(received[0], 1);
+}
+
+TEST(socket_test, GameSocketTest03RecvTimeoutFailsInsteadOfBlocking) {
+    GameSocket listener("47014");
+    GameSocket client("localhost", "47014");
+    GameSocket peer = listener.acceptClient();
+    SocketOptions options;
+    options.recv_timeout_ms = 20;
+    client.applyOptions(options);
+
+    std::int8_t byte;
+    EXPECT_THROW(client.recvData(&byte, sizeof(byte)), std::runtime_error);
+}
+
+TEST(socket_test, GameSocketTest04AcceptWithoutFdsFailsButKeepsListening) {
+    GameSocket listener("47015");
+    GameSocket client("localhost", "47015");
+    struct rlimit original{};
+    ASSERT_EQ(getrlimit(RLIMIT_NOFILE, &original), 0);
+    // el proximo fd que se abra ya queda fuera del limite
+    int next_fd = dup(0);
+    ASSERT_NE(next_fd, -1);
+    close(next_fd);
+    struct rlimit limited = original;
+    limited.rlim_cur = next_fd;
+    ASSERT_EQ(setrlimit(RLIMIT_NOFILE, &limited), 0);
+
+    bool out_of_resources = false;
+    try {
+        GameSocket peer = listener.acceptClient();
+    } catch (const AcceptFailed& e) {
+        out_of_resources = e.out_of_resources;
+    }
+    ASSERT_EQ(setrlimit(RLIMIT_NOFILE, &original), 0);
+    EXPECT_TRUE(out_of_resources);
+
+    // la conexion sigue encolada y se acepta al liberar fds
+    EXPECT_NO_THROW(GameSocket peer = listener.acceptClient());
+}
+
+TEST(socket_test, GameSocketTest05SendTimeoutCountsAsDisconnect) {
+    GameSocket listener("47016");
+    GameSocket client("localhost", "47016");
+    GameSocket peer = listener.acceptClient();
+    SocketOptions options;
+    options.send_timeout_ms = 20;
+    options.send_buffer = 4096;
+    peer.applyOptions(options);
+
+    // el cliente no lee nunca: se llenan los buffers y vence el send
+    std::vector<std::int8_t> payload(8 * 1024 * 1024, 1);
+    EXPECT_THROW(peer.sendData(payload.data(), payload.size()), ClosedSocket);
+}
+
+TEST(socket_test, BufferPoolTest00ReleasedBuffersComeBackEmptyKeepingCapacity) {
+    BufferPool pool(256, 2);
+    EXPECT_EQ(pool.available(), 2u);
+
+    std::unique_ptr<std::vector<std::int8_t>> buffer = pool.acquire();
+    EXPECT_GE(buffer->capacity(), 256u);
+    buffer->resize(1000);
+    const std::int8_t* data = buffer->data();
+    EXPECT_EQ(pool.available(), 1u);
+
+    // el ultimo que se devolvio es el primero que se reusa
+    pool.release(std::move(buffer));
+    std::unique_ptr<std::vector<std::int8_t>> reused = pool.acquire();
+    EXPECT_EQ(pool.available(), 1u);
+    EXPECT_TRUE(reused->empty());
+    EXPECT_GE(reused->capacity(), 1000u);
+    EXPECT_EQ(reused->data(), data);
+}
+
+// Un snapshot con muchos zombies parecidos, tick indica cuanto se movieron.
+static std::vector<std::int8_t> hordeSnapshot(int tick) {
+    std::vector<std::pair<std::uint16_t, ElementStateDTO>> elements;
+    for (std::uint16_t id = 0; id < 300; id++) {
+        elements.emplace_back(id, ElementStateDTO{ZOMBIE, ZOMBIE_WALK, -1, 1000 + id * 7 + tick,
+                                                  id % 150, 100, 100, 0, 0, 0, 0});
+    }
+    return GameStateFeedback(std::move(elements)).serialize();
+}
+
+TEST(socket_test, CompressionTest00FramesRoundTripInOrder) {
+    FrameDeflater deflater(1);
+    FrameInflater inflater;
+    for (int tick = 0; tick < 5; tick++) {
+        std::vector<std::int8_t> raw = hordeSnapshot(tick);
+        std::vector<std::int8_t> compressed;
+        deflater.compress(raw.data(), raw.size(), compressed);
+        EXPECT_LT(compressed.size(), raw.size() / 2);
+
+        std::vector<std::int8_t> restored;
+        inflater.decompress(compressed.data(), compressed.size(), raw.size(), restored);
+        EXPECT_EQ(restored, raw);
+    }
+}
+
+TEST(socket_test, CompressionTest01NextTickReusesTheContext) {
+    FrameDeflater deflater(6);
+    std::vector<std::int8_t> first;
+    std::vector<std::int8_t> raw = hordeSnapshot(0);
+    deflater.compress(raw.data(), raw.size(), first);
+
+    // el mismo estado otra vez es casi todo referencias al anterior
+    std::vector<std::int8_t> second;
+    deflater.compress(raw.data(), raw.size(), second);
+    EXPECT_LT(second.size(), first.size() / 4);
+}
+
+TEST(socket_test, CompressionTest02WrongRawSizeThrows) {
+    FrameDeflater deflater(1);
+    std::vector<std::int8_t> raw = hordeSnapshot(0);
+    std::vector<std::int8_t> compressed;
+    deflater.compress(raw.data(), raw.size(), compressed);
+
+    FrameInflater inflater;
+    std::vector<std::int8_t> restored;
+    EXPECT_THROW(inflater.decompress(compressed.data(), compressed.size(), raw.size() - 1, restored),
+                 std::runtime_error);
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -478,6 +478,25 @@ TEST(soldier_test, Test22MoveWithNoCollisionOnLimit) {
 
 }
 
+TEST(soldier_test, Test23CollidesAcrossMapLimitAndInBatch) {
+    Position left(1.0, 10.0, 4.0, 4.0, MAP_DIM, MAP_DIM);
+    Position right(MAP_DIM - 1.0, 10.0, 4.0, 4.0, MAP_DIM, MAP_DIM);
+    Position far(50.0, 10.0, 4.0, 4.0, MAP_DIM, MAP_DIM);
+    Position wide(50.0, 10.0, 40.0, 4.0, MAP_DIM, MAP_DIM);
+    ASSERT_TRUE(left.collides(right));
+    ASSERT_TRUE(right.collides(left));
+    ASSERT_FALSE(left.collides(far));
+    ASSERT_TRUE(far.collides(wide));
+    ASSERT_TRUE(wide.collides(far));
+
+    Aabb boxes[] = {right.getAabb(), far.getAabb(), wide.getAabb()};
+    uint8_t hits[3];
+    ASSERT_EQ(left.collides(boxes, 3, hits), 1);
+    ASSERT_EQ(hits[0], 1);
+    ASSERT_EQ(hits[1], 0);
+    ASSERT_EQ(hits[2], 0);
+}
+
 int main(int argc, char** argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
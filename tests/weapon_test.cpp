@@ -7,6 +7,7 @@
 #include "GameLogic/Zombies/zombiefactory.h"
 #include "GameLogic/Throwables/throwable.h"
 #include "GameLogic/position.h"
+#include "GameLogic/hitscan.h"
 #include "yaml-cpp/yaml.h"
 
 using YAML::LoadFile;
@@ -238,6 +239,30 @@ TEST(weapon_test, Test05ShootScoutToTwoSoldiersInTheSameRow) {
 
 }
 
+TEST(weapon_test, Test06HitScanKeepsNearestInOrder) {
+    ZombieFactory zfactory;
+    std::map<uint32_t, std::shared_ptr<Zombie>> zombies;
+    const double xs[] = {60, 20, 90, 40, 300};
+    for (uint32_t id = 0; id < 5; id++) {
+        std::shared_ptr<Zombie> zombie = zfactory.create(id, ZOMBIE);
+        Position pos(xs[id], 10, zombie->getWidth(), zombie->getHeight(), 1000, 100);
+        zombie->setPosition(std::move(pos));
+        zombies.emplace(id, std::move(zombie));
+    }
+    zombies.at(1)->die(ON);
+
+    HitScan scan;
+    scan.load(zombies);
+    ASSERT_EQ(scan.size(), 4);
+    HitScan::Hits hits;
+    ASSERT_EQ(scan.scan(10, 200, 5, 15, 10, 2, hits), 2);
+    ASSERT_EQ(hits[0].id, 3);
+    ASSERT_EQ(hits[1].id, 0);
+    ASSERT_EQ(scan.scan(10, 200, 5, 15, 10, HitScan::MAX_HITS, hits), 3);
+    ASSERT_EQ(hits[2].id, 2);
+    ASSERT_EQ(scan.scan(10, 200, 50, 60, 10, HitScan::MAX_HITS, hits), 0);
+}
+
 int main(int argc, char** argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();